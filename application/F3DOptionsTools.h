@@ -34,6 +34,7 @@ static inline const OptionsDict DefaultAppOptions = {
   { "config", "" },
   { "no-config", "false" },
   { "no-render", "false" },
+  { "server", "false" },
   { "rendering-backend", "auto" },
   { "max-size", "" },
   { "animation-time", "" },
@@ -62,6 +63,9 @@ static inline const OptionsDict DefaultAppOptions = {
   { "reference-threshold", "0.04" },
   { "interaction-test-record", "" },
   { "interaction-test-play", "" },
+  { "interaction-test-fast", "false" },
+  { "benchmark", "" },
+  { "trace", "" },
   { "command-script", "" },
   { "frame-rate", "30.0" },
 };
@@ -77,6 +81,7 @@ static inline const std::map<std::string_view, std::string_view> LibOptionsNames
   { "animation-progress", "ui.animation_progress" },
   { "animation-speed-factor", "scene.animation.speed_factor" },
   { "anti-aliasing", "render.effect.antialiasing.mode" },
+  { "anti-aliasing-samples", "render.effect.antialiasing.samples" },
   { "armature", "render.armature.enable" },
   { "axes-grid", "render.axes_grid.enable" },
   { "axis", "ui.axis" },
@@ -114,6 +119,7 @@ static inline const std::map<std::string_view, std::string_view> LibOptionsNames
   { "grid-absolute", "render.grid.absolute" },
   { "grid-color", "render.grid.color" },
   { "grid-reflection", "render.grid.reflection" },
+  { "grid-reflection-resolution", "render.grid.reflection_resolution" },
   { "grid-subdivisions", "render.grid.subdivisions" },
   { "grid-unit", "render.grid.unit" },
   { "hdri-ambient", "render.hdri.ambient" },
@@ -125,7 +131,9 @@ static inline const std::map<std::string_view, std::string_view> LibOptionsNames
   { "light-intensity", "render.light.intensity" },
   { "line-width", "render.line_width" },
   { "loading-progress", "ui.loader_progress" },
+  { "memory-budget", "scene.memory_budget" },
   { "metadata", "ui.metadata" },
+  { "metadata-memory", "ui.metadata_memory" },
   { "metallic", "model.material.metallic" },
   { "normal-glyphs", "model.normal_glyphs.enable" },
   { "normal-glyphs-scale", "model.normal_glyphs.scale" },
@@ -148,6 +156,7 @@ static inline const std::map<std::string_view, std::string_view> LibOptionsNames
   { "texture-material", "model.material.texture" },
   { "texture-normal", "model.normal.texture" },
   { "textures-transform", "model.textures_transform" },
+  { "tile-size", "render.tile_size" },
   { "tone-mapping", "render.effect.tone_mapping" },
   { "unlit", "model.unlit" },
   { "up", "scene.up_direction" },
@@ -40,9 +40,13 @@
 #include "utils.h"
 #include "window.h"
 
+#include "nlohmann/json.hpp"
+
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cmath>
 #include <csignal>
 #include <filesystem>
@@ -71,6 +75,14 @@ f3d::interactor* GlobalInteractor = nullptr;
 
 constexpr std::string_view F3D_PIPED = "-";
 
+// Number of frames rendered while orbiting the camera with --benchmark
+constexpr int BenchmarkFrames = 360;
+
+#if F3D_MODULE_DMON
+// Delay without change of the watched files before reloading them
+constexpr std::chrono::milliseconds WatchSettleDelay(100);
+#endif
+
 class F3DStarter::F3DInternals
 {
 public:
@@ -99,6 +111,7 @@ public:
     bool BindingsList;
     bool NoBackground;
     bool NoRender;
+    bool Server;
     std::string RenderingBackend;
     std::optional<double> MaxSize;
     std::optional<double> AnimationTime;
@@ -121,6 +134,9 @@ public:
     double RefThreshold;
     std::string InteractionTestRecordFile;
     std::string InteractionTestPlayFile;
+    bool InteractionTestFast;
+    std::string Benchmark;
+    std::string Trace;
     std::string CommandScriptFile;
     std::string AntiAliasing;
     std::string AntiAliasingMode; // Deprecated
@@ -249,8 +265,9 @@ public:
 
     if (forceStdErr)
     {
-      f3d::log::info("Output image will be saved to stdout, all log types including debug and info "
-                     "levels are redirected to stderr");
+      f3d::log::info("Standard output is reserved for the output image or the server job "
+                     "statuses, all log types including debug and info levels are redirected to "
+                     "stderr");
     }
   }
 
@@ -260,10 +277,14 @@ public:
   {
     F3DStarter* self = reinterpret_cast<F3DStarter*>(userData);
     const std::lock_guard<std::mutex> lock(self->Internals->FilesToWatchMutex);
-    if (std::ranges::find_if(self->Internals->FilesToWatch, [&](const auto& path)
-          { return path.filename() == filename; }) != self->Internals->FilesToWatch.end())
+    for (const fs::path& path : self->Internals->FilesToWatch)
     {
-      self->Internals->ReloadFileRequested = true;
+      if (path.filename() == filename)
+      {
+        self->Internals->ChangedFiles.insert(path);
+        self->Internals->LastChangeTime = std::chrono::steady_clock::now();
+        self->Internals->ReloadFileRequested = true;
+      }
     }
   }
 #endif
@@ -323,6 +344,110 @@ public:
     return true;
   }
 
+  /**
+   * Measure the rendering performance of the loaded files and save the results in a JSON file:
+   * the first frame time, the frame times while orbiting the camera around the scene and playing
+   * the animation if any, the average GPU time of the frame stages and the peak memory usage.
+   * Returns true on success, false on failure (error already logged).
+   */
+  bool RunBenchmark(const fs::path& outputPath, double loadTime)
+  {
+    using clock = std::chrono::steady_clock;
+    const auto elapsedMs = [](clock::time_point start)
+    { return std::chrono::duration<double, std::milli>(clock::now() - start).count(); };
+
+    f3d::window& window = this->Engine->getWindow();
+    f3d::scene& scene = this->Engine->getScene();
+
+    // Frame stages are only profiled with the fps counter
+    f3d::options& options = this->Engine->getOptions();
+    options.ui.fps = true;
+
+    // Rendering is asynchronous, each frame is read back so that the clock stops once the GPU
+    // is done. A single TAA sample is rendered per frame, like in an interactive session.
+    options.render.effect.antialiasing.samples = 1;
+
+    // First frame includes the actors setup and the shaders compilation
+    clock::time_point start = clock::now();
+    static_cast<void>(window.renderToImage());
+    const double firstFrameTime = elapsedMs(start);
+
+    const auto [minTime, maxTime] = scene.animationTimeRange();
+    const bool animated = maxTime > minTime;
+
+    std::vector<double> frameTimes;
+    std::vector<std::pair<std::string, double>> stageTimes;
+    int stageSamples = 0;
+    for (int frame = 0; frame < ::BenchmarkFrames; frame++)
+    {
+      start = clock::now();
+      window.getCamera().azimuth(360.0 / ::BenchmarkFrames);
+      if (animated)
+      {
+        scene.loadAnimationTime(minTime + (maxTime - minTime) * frame / (::BenchmarkFrames - 1));
+      }
+      static_cast<void>(window.renderToImage());
+      frameTimes.push_back(elapsedMs(start));
+
+      // GPU timings are read back a few frames later, only the new ones are returned
+      const std::vector<std::pair<std::string, double>> timings = window.getFrameTimings();
+      if (!timings.empty())
+      {
+        stageSamples++;
+        for (const auto& [stage, time] : timings)
+        {
+          auto it = std::ranges::find(stageTimes, stage, &std::pair<std::string, double>::first);
+          if (it == stageTimes.end())
+          {
+            it = stageTimes.emplace(stageTimes.end(), stage, 0.0);
+          }
+          it->second += time * 1e3;
+        }
+      }
+    }
+
+    std::vector<double> sortedTimes = frameTimes;
+    std::ranges::sort(sortedTimes);
+    const size_t count = sortedTimes.size();
+    const double mean = std::accumulate(sortedTimes.begin(), sortedTimes.end(), 0.0) / count;
+    const size_t p95Index = std::min(count - 1, static_cast<size_t>(std::ceil(0.95 * count)) - 1);
+
+    nlohmann::ordered_json json;
+    json["version"] = F3D::AppVersionFull;
+    json["files"] = nlohmann::json::array();
+    for (const fs::path& file : this->LoadedFiles)
+    {
+      json["files"].push_back(file.string());
+    }
+    json["resolution"] = { window.getWidth(), window.getHeight() };
+    json["load_ms"] = loadTime;
+    json["first_frame_ms"] = firstFrameTime;
+    json["frames"] = count;
+    json["animated"] = animated;
+    json["frame_ms"] = { { "mean", mean }, { "median", sortedTimes[count / 2] },
+      { "p95", sortedTimes[p95Index] }, { "min", sortedTimes.front() },
+      { "max", sortedTimes.back() } };
+    json["stages_ms"] = nlohmann::json::object();
+    for (const auto& [stage, time] : stageTimes)
+    {
+      json["stages_ms"][stage] = time / stageSamples;
+    }
+    json["peak_memory_bytes"] = F3DSystemTools::GetPeakMemoryUsage();
+
+    f3d::log::info("Benchmark: loaded in ", loadTime, " ms, first frame in ", firstFrameTime,
+      " ms, ", mean, " ms per frame over ", count, " frames");
+
+    std::ofstream file(outputPath);
+    if (!file.is_open())
+    {
+      f3d::log::error("Could not write benchmark results to ", outputPath);
+      return false;
+    }
+    file << json.dump(2) << std::endl;
+    f3d::log::debug("Benchmark results saved to ", outputPath);
+    return true;
+  }
+
   /**
    * Create a filename template and substitute the following variables:
    * - `{app}`: application name (ie. `F3D`)
@@ -726,7 +851,8 @@ public:
 
     // Update Verbose level as soon as possible
     F3DInternals::SetVerboseLevel(
-      this->AppOptions.VerboseLevel, this->AppOptions.Output == F3D_PIPED);
+      this->AppOptions.VerboseLevel,
+      this->AppOptions.Output == F3D_PIPED || this->AppOptions.Server);
 
     // Load any new plugins
     F3DPluginsTools::LoadPlugins(this->AppOptions.Plugins, this->AppOptions.PluginsPath);
@@ -782,6 +908,7 @@ public:
     this->ParseOption(appOptions, "list-bindings", this->AppOptions.BindingsList);
     this->ParseOption(appOptions, "no-background", this->AppOptions.NoBackground);
     this->ParseOption(appOptions, "no-render", this->AppOptions.NoRender);
+    this->ParseOption(appOptions, "server", this->AppOptions.Server);
     this->ParseOption(appOptions, "rendering-backend", this->AppOptions.RenderingBackend);
     this->ParseOption(appOptions, "max-size", this->AppOptions.MaxSize);
     this->ParseOption(appOptions, "animation-time", this->AppOptions.AnimationTime);
@@ -818,6 +945,9 @@ public:
       appOptions, "interaction-test-record", this->AppOptions.InteractionTestRecordFile);
     this->ParseOption(
       appOptions, "interaction-test-play", this->AppOptions.InteractionTestPlayFile);
+    this->ParseOption(appOptions, "interaction-test-fast", this->AppOptions.InteractionTestFast);
+    this->ParseOption(appOptions, "benchmark", this->AppOptions.Benchmark);
+    this->ParseOption(appOptions, "trace", this->AppOptions.Trace);
     this->ParseOption(appOptions, "command-script", this->AppOptions.CommandScriptFile);
   }
 
@@ -1019,10 +1149,17 @@ public:
   int CurrentFilesGroupIndex = -1;
   std::vector<std::byte> PipedBuffer;
 
+  // File the trace is saved into on exit, if tracing
+  fs::path TraceFile;
+
 #if F3D_MODULE_DMON
   // dmon related
   std::mutex FilesToWatchMutex;
   std::map<fs::path, dmon_watch_id> FolderWatchIds;
+
+  // Watched files changed since the last reload, and when the last change happened
+  std::set<fs::path> ChangedFiles;
+  std::chrono::steady_clock::time_point LastChangeTime;
 #endif
 
   // Event loop atomics
@@ -1042,6 +1179,21 @@ F3DStarter::F3DStarter()
 //----------------------------------------------------------------------------
 F3DStarter::~F3DStarter()
 {
+  if (!this->Internals->TraceFile.empty())
+  {
+    f3d::engine::setTracing(false);
+    std::ofstream file(this->Internals->TraceFile);
+    if (file.is_open())
+    {
+      file << f3d::engine::getTrace();
+      f3d::log::debug("Trace saved to ", this->Internals->TraceFile);
+    }
+    else
+    {
+      f3d::log::error("Could not write trace to ", this->Internals->TraceFile);
+    }
+  }
+
 #if F3D_MODULE_DMON
   // deinit dmon
   dmon_deinit();
@@ -1099,6 +1251,15 @@ int F3DStarter::Start(int argc, char** argv)
     renderToStdout = localOutput == F3D_PIPED;
   }
 
+  // Server job statuses are written on stdout, keep it free of any log
+  bool server = false;
+  iter = cliOptionsDict.find("server");
+  if (iter != cliOptionsDict.end())
+  {
+    // XXX: Discarding bool return because this cannot return false with a boolean
+    F3DOptionsTools::Parse(iter->second, server);
+  }
+
   this->Internals->AppOptions.VerboseLevel = "info";
   iter = cliOptionsDict.find("verbose");
   if (iter != cliOptionsDict.end())
@@ -1108,7 +1269,8 @@ int F3DStarter::Start(int argc, char** argv)
   }
 
   // Set verbosity level early from command line
-  F3DInternals::SetVerboseLevel(this->Internals->AppOptions.VerboseLevel, renderToStdout);
+  F3DInternals::SetVerboseLevel(
+    this->Internals->AppOptions.VerboseLevel, renderToStdout || server);
 
   f3d::log::debug("========== Initializing Options ==========");
 
@@ -1161,6 +1323,13 @@ int F3DStarter::Start(int argc, char** argv)
 
   double deltaTime = 1.0 / this->Internals->AppOptions.FrameRate;
 
+  // Record a trace of the loading and rendering stages, saved on exit
+  this->Internals->TraceFile = f3d::utils::collapsePath(this->Internals->AppOptions.Trace);
+  if (!this->Internals->TraceFile.empty())
+  {
+    f3d::engine::setTracing(true);
+  }
+
   if (this->Internals->AppOptions.NoRender)
   {
     this->Internals->Engine = std::make_unique<f3d::engine>(f3d::engine::createNone());
@@ -1168,7 +1337,8 @@ int F3DStarter::Start(int argc, char** argv)
   else
   {
     bool offscreen = !this->Internals->AppOptions.Reference.empty() ||
-      !this->Internals->AppOptions.Output.empty() || this->Internals->AppOptions.BindingsList;
+      !this->Internals->AppOptions.Output.empty() || this->Internals->AppOptions.BindingsList ||
+      this->Internals->AppOptions.Server || !this->Internals->AppOptions.Benchmark.empty();
 
     try
     {
@@ -1227,6 +1397,15 @@ int F3DStarter::Start(int argc, char** argv)
   this->Internals->Engine->setOptions(this->Internals->LibOptions);
   f3d::log::debug("Engine configured");
 
+  if (this->Internals->AppOptions.Server)
+  {
+    if (!inputFiles.empty())
+    {
+      f3d::log::warn("Input files are ignored in server mode, provide them in jobs instead");
+    }
+    return this->Serve();
+  }
+
   // Add all input files
   for (auto& file : inputFiles)
   {
@@ -1234,7 +1413,10 @@ int F3DStarter::Start(int argc, char** argv)
   }
 
   // Load a file
+  std::chrono::steady_clock::time_point loadStart = std::chrono::steady_clock::now();
   this->LoadFileGroup();
+  const std::chrono::duration<double, std::milli> loadTime =
+    std::chrono::steady_clock::now() - loadStart;
 
   if (!this->Internals->AppOptions.NoRender)
   {
@@ -1260,6 +1442,19 @@ int F3DStarter::Start(int argc, char** argv)
       throw F3DExNoProcess("bindings list requested");
     }
 
+    // Measure the rendering performance and exits if needed
+    fs::path benchmarkFile = f3d::utils::collapsePath(this->Internals->AppOptions.Benchmark);
+    if (!benchmarkFile.empty())
+    {
+      if (this->Internals->LoadedFiles.empty())
+      {
+        f3d::log::error("No file loaded, no benchmark performed");
+        return EXIT_FAILURE;
+      }
+      return this->Internals->RunBenchmark(benchmarkFile, loadTime.count()) ? EXIT_SUCCESS
+                                                                             : EXIT_FAILURE;
+    }
+
     // Play recording if any
     fs::path interactionTestPlayFile =
       f3d::utils::collapsePath(this->Internals->AppOptions.InteractionTestPlayFile);
@@ -1267,7 +1462,8 @@ int F3DStarter::Start(int argc, char** argv)
     {
       // For better testing, render once before the interaction
       window.render();
-      if (!interactor.playInteraction(interactionTestPlayFile, deltaTime))
+      if (!interactor.playInteraction(
+            interactionTestPlayFile, deltaTime, this->Internals->AppOptions.InteractionTestFast))
       {
         return EXIT_FAILURE;
       }
@@ -1382,6 +1578,18 @@ int F3DStarter::Start(int argc, char** argv)
           f3d::log::error("Current rendering difference with reference image: ", error,
             " is higher than the threshold of ", threshold, ".\n");
 
+          constexpr unsigned int tileSize = 64;
+          const std::vector<double> tileErrors = img.compareTiles(ref, tileSize);
+          const auto worst = std::ranges::max_element(tileErrors);
+          if (tileErrors.size() > 1)
+          {
+            const auto tileIdx = static_cast<unsigned int>(worst - tileErrors.begin());
+            const unsigned int tilesX = (img.getWidth() + tileSize - 1) / tileSize;
+            f3d::log::error("Highest difference is in the ", tileSize, "x", tileSize,
+              " tile starting at pixel (", (tileIdx % tilesX) * tileSize, ", ",
+              (tileIdx / tilesX) * tileSize, ") with an error of ", *worst, ".\n");
+          }
+
           try
           {
             img.save(output);
@@ -2052,14 +2260,162 @@ bool F3DStarter::LoadRelativeFileGroup(int index, bool restoreCamera, bool force
   return true;
 }
 
+//----------------------------------------------------------------------------
+int F3DStarter::Serve()
+{
+  if (this->Internals->AppOptions.NoRender)
+  {
+    f3d::log::error("Server mode is not compatible with --no-render");
+    return EXIT_FAILURE;
+  }
+
+  f3d::log::info("Server started, waiting for jobs on standard input");
+
+  std::string job;
+  while (std::getline(std::cin, job))
+  {
+    if (job.empty())
+    {
+      continue;
+    }
+    if (job == "quit")
+    {
+      break;
+    }
+
+    const bool success = this->ProcessServerJob(job);
+
+    // Always end a job with a status line so clients can wait for it
+    std::cout << (success ? "done" : "failed") << std::endl;
+  }
+
+  f3d::log::debug("Server stopped");
+  return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+bool F3DStarter::ProcessServerJob(const std::string& job)
+{
+  f3d::log::debug("========== Processing job ==========");
+
+  std::vector<std::string> inputFiles;
+  F3DOptionsTools::OptionsDict jobOptionsDict;
+  try
+  {
+    std::vector<std::string> args = f3d::utils::tokenize(job);
+
+    // These options print on stdout, which is reserved for the job statuses
+    constexpr std::array<std::string_view, 6> printingOptions = { "-h", "--help", "--version",
+      "--list-readers", "--list-rendering-backends", "--scan-plugins" };
+    for (const std::string& arg : args)
+    {
+      const std::string_view name = std::string_view(arg).substr(0, arg.find('='));
+      if (std::ranges::find(printingOptions, name) != printingOptions.end())
+      {
+        f3d::log::error("Option ", name, " is not supported in server jobs");
+        return false;
+      }
+    }
+
+    args.insert(args.begin(), F3D::AppName);
+    std::vector<char*> argv;
+    std::ranges::transform(
+      args, std::back_inserter(argv), [](std::string& arg) { return arg.data(); });
+    jobOptionsDict =
+      F3DOptionsTools::ParseCLIOptions(static_cast<int>(argv.size()), argv.data(), inputFiles);
+  }
+  catch (const f3d::utils::tokenize_exception& ex)
+  {
+    f3d::log::error("Could not parse job: ", ex.what());
+    return false;
+  }
+  catch (const F3DExNoProcess&)
+  {
+    return false;
+  }
+  catch (const F3DExFailure&)
+  {
+    return false;
+  }
+
+  // Job options have the priority over CLI options, for this job only.
+  // The engine is kept and the scene cleared, only the options that changed
+  // since the previous job are actually reconfigured in the rendering stack.
+  this->Internals->CLIOptionsEntries.emplace_back(jobOptionsDict, "", "", "job options");
+  this->Internals->DynamicOptionsEntries.clear();
+  this->Internals->FilesGroups.clear();
+  this->Internals->CurrentFilesGroupIndex = -1;
+
+  for (const std::string& file : inputFiles)
+  {
+    this->AddFile(f3d::utils::collapsePath(file));
+  }
+  this->LoadFileGroup(0, false, true);
+  this->Internals->ApplyPositionAndResolution();
+
+  bool success = false;
+  if (this->Internals->LoadedFiles.empty())
+  {
+    f3d::log::error("No file loaded in job, no rendering performed");
+  }
+  else if (this->Internals->AppOptions.Output.empty())
+  {
+    f3d::log::error("No output provided in job, no rendering performed");
+  }
+  else
+  {
+    success = this->Internals->renderAndSave(this->Internals->Engine->getWindow(),
+      this->Internals->prepareFilenameTemplate(
+        f3d::utils::collapsePath(this->Internals->AppOptions.Output)),
+      false);
+  }
+
+  this->Internals->CLIOptionsEntries.pop_back();
+  return success;
+}
+
 //----------------------------------------------------------------------------
 void F3DStarter::EventLoop()
 {
   if (this->Internals->ReloadFileRequested)
   {
+#if F3D_MODULE_DMON
+    std::set<fs::path> changedFiles;
+    {
+      // Editors may write a file in multiple steps, wait for the changes to settle
+      const std::lock_guard<std::mutex> lock(this->Internals->FilesToWatchMutex);
+      if (std::chrono::steady_clock::now() - this->Internals->LastChangeTime < ::WatchSettleDelay)
+      {
+        return;
+      }
+      changedFiles.swap(this->Internals->ChangedFiles);
+      this->Internals->ReloadFileRequested = false;
+    }
+
+    // Only reload the changed files, keeping the other files, the camera and the coloring.
+    // Fall back to reloading the whole file group if any of them cannot be reloaded,
+    // eg: a watched file that could not be loaded before.
+    f3d::interactor& interactor = this->Internals->Engine->getInteractor();
+    try
+    {
+      for (const fs::path& path : changedFiles)
+      {
+        this->Internals->Engine->getScene().reload(path);
+      }
+      interactor.requestRender();
+      interactor.triggerNotification("File Reloaded");
+    }
+    catch (const f3d::scene::load_failure_exception& ex)
+    {
+      f3d::log::debug("Could not reload changed files, reloading the file group: ", ex.what());
+      this->LoadRelativeFileGroup(0, true, true);
+      interactor.triggerNotification("File Group Reloaded");
+    }
+#else
     this->LoadRelativeFileGroup(0, true, true);
     this->Internals->ReloadFileRequested = false;
     this->Internals->Engine->getInteractor().triggerNotification("File Group Reloaded");
+#endif
   }
 }
 
@@ -9,6 +9,7 @@
 
 #include <filesystem>
 #include <memory>
+#include <string>
 #include <vector>
 
 class F3DStarter
@@ -78,6 +79,18 @@ private:
   void LoadFileGroupInternal(
     const std::vector<std::filesystem::path>& paths, bool clear, const std::string& groupIdx);
 
+  /**
+   * Internal method running the server mode: read jobs from the standard input, one per line,
+   * and process them with the already configured engine until the input is closed.
+   */
+  int Serve();
+
+  /**
+   * Internal method used to process a server job, using the same syntax as the command line.
+   * Returns true on success, false on failure (error already logged).
+   */
+  bool ProcessServerJob(const std::string& job);
+
   /**
    * Internal event loop that is triggered repeatedly to handle specific events:
    * - Render
@@ -11,6 +11,10 @@
 
 #if defined(_WIN32)
 #include <windows.h>
+// must be included after windows.h
+#include <psapi.h>
+#else
+#include <sys/resource.h>
 #endif
 #ifdef __APPLE__
 #include <mach-o/dyld.h>
@@ -201,3 +205,29 @@ fs::path F3DSystemTools::GetBinaryResourceDirectory()
 
   return dirPath;
 }
+
+//----------------------------------------------------------------------------
+std::size_t F3DSystemTools::GetPeakMemoryUsage()
+{
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+  {
+    return counters.PeakWorkingSetSize;
+  }
+  return 0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0;
+  }
+#ifdef __APPLE__
+  // in bytes on macOS
+  return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+  // in kilobytes on Linux and BSD
+  return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
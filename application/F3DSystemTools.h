@@ -7,6 +7,7 @@
 #ifndef F3DSystemTools_h
 #define F3DSystemTools_h
 
+#include <cstddef>
 #include <filesystem>
 #include <string>
 #include <vector>
@@ -18,6 +19,11 @@ std::vector<std::string> GetVectorEnvironnementVariable(const std::string& envVa
 std::filesystem::path GetUserConfigFileDirectory();
 std::filesystem::path GetUserScreenshotDirectory();
 std::filesystem::path GetBinaryResourceDirectory();
+
+/**
+ * Get the peak resident memory of the process in bytes, 0 if not supported.
+ */
+std::size_t GetPeakMemoryUsage();
 }
 
 #endif
@@ -0,0 +1,20 @@
+cmake_minimum_required(VERSION 3.19)
+
+execute_process(
+  COMMAND ${F3D_EXE} --no-config --server --resolution=300,300
+  INPUT_FILE ${F3D_SERVER_JOBS}
+  OUTPUT_VARIABLE _f3d_server_output
+  ERROR_QUIET
+  COMMAND_ERROR_IS_FATAL ANY
+  )
+
+if(NOT _f3d_server_output STREQUAL "done\ndone\nfailed\nfailed\n")
+  message(FATAL_ERROR "Unexpected server output:\n${_f3d_server_output}")
+endif()
+
+string(REPLACE "|" ";" _f3d_server_outputs "${F3D_SERVER_OUTPUTS}")
+foreach(_f3d_server_output_file ${_f3d_server_outputs})
+  if(NOT EXISTS ${_f3d_server_output_file})
+    message(FATAL_ERROR "Server did not output ${_f3d_server_output_file}")
+  endif()
+endforeach()
@@ -0,0 +1,13 @@
+cmake_minimum_required(VERSION 3.19)
+
+if(NOT EXISTS ${F3D_TRACE_FILE})
+  message(FATAL_ERROR "Trace file ${F3D_TRACE_FILE} was not written")
+endif()
+
+file(READ ${F3D_TRACE_FILE} _f3d_trace)
+foreach(_f3d_trace_scope "scene::add" "create importer suzanne.ply" "update importers" "setup actor 0")
+  string(FIND "${_f3d_trace}" "\"name\":\"${_f3d_trace_scope}\"" _f3d_trace_index)
+  if(_f3d_trace_index EQUAL -1)
+    message(FATAL_ERROR "Trace does not contain the \"${_f3d_trace_scope}\" scope:\n${_f3d_trace}")
+  endif()
+endforeach()
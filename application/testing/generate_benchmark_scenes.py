@@ -0,0 +1,207 @@
+"""
+Generate the large scenes used by the benchmark tests, see tests.benchmark.cmake.
+
+Usage: python generate_benchmark_scenes.py <output_directory>
+
+Only the python standard library is used. The scenes are deterministic and are not
+generated again if they already exist in the output directory.
+"""
+
+import array
+import json
+import math
+import random
+import struct
+import sys
+from pathlib import Path
+
+# Large triangle mesh, MESH_RESOLUTION^2 vertices, 2 * (MESH_RESOLUTION - 1)^2 triangles
+MESH_RESOLUTION = 1024
+
+# Gaussian splats cloud
+SPLAT_COUNT = 5_000_000
+
+# Assembly of distinct parts
+PART_COUNT = 10_000
+
+# Dense volume, VOLUME_RESOLUTION^3 voxels
+VOLUME_RESOLUTION = 256
+
+
+def generate_mesh(path: Path) -> None:
+    """Binary PLY of a wavy surface"""
+    n = MESH_RESOLUTION
+    points = array.array("f")
+    for j in range(n):
+        y = j / (n - 1)
+        for i in range(n):
+            x = i / (n - 1)
+            points.extend((x, y, 0.05 * math.sin(20 * x) * math.cos(20 * y)))
+
+    face = struct.Struct("<Biii")
+    faces = bytearray()
+    for j in range(n - 1):
+        for i in range(n - 1):
+            a = j * n + i
+            faces += face.pack(3, a, a + 1, a + n + 1)
+            faces += face.pack(3, a, a + n + 1, a + n)
+
+    header = (
+        "ply\n"
+        "format binary_little_endian 1.0\n"
+        f"element vertex {n * n}\n"
+        "property float x\n"
+        "property float y\n"
+        "property float z\n"
+        f"element face {2 * (n - 1) * (n - 1)}\n"
+        "property list uchar int vertex_indices\n"
+        "end_header\n"
+    )
+
+    if sys.byteorder != "little":
+        points.byteswap()
+    with open(path, "wb") as f:
+        f.write(header.encode("ascii"))
+        f.write(points.tobytes())
+        f.write(faces)
+
+
+def generate_splats(path: Path) -> None:
+    """Antimatter15 .splat file of splats distributed in a noisy sphere shell"""
+    rng = random.Random(0)
+    splat = struct.Struct("<6f8B")
+    with open(path, "wb") as f:
+        chunk = bytearray()
+        for i in range(SPLAT_COUNT):
+            z = 1 - 2 * (i + 0.5) / SPLAT_COUNT
+            r = math.sqrt(1 - z * z)
+            phi = i * 2.399963229728653  # golden angle
+            radius = 1 + 0.05 * rng.random()
+            chunk += splat.pack(
+                radius * r * math.cos(phi),
+                radius * r * math.sin(phi),
+                radius * z,
+                0.002,
+                0.002,
+                0.002,
+                int(127.5 * (1 + z)),
+                int(127.5 * (1 + math.cos(phi))),
+                200,
+                200,
+                255,  # identity rotation, quaternion stored as (q + 1) * 128
+                128,
+                128,
+                128,
+            )
+            if len(chunk) > (1 << 24):
+                f.write(chunk)
+                chunk = bytearray()
+        f.write(chunk)
+
+
+def generate_assembly(path: Path) -> None:
+    """glTF with a distinct mesh and node per part, arranged in a grid"""
+    # Unit cube, 8 vertices and 12 triangles
+    positions = struct.pack(
+        "<24f",
+        *(c for v in range(8) for c in ((v & 1) * 1.0, (v >> 1 & 1) * 1.0, (v >> 2 & 1) * 1.0)),
+    )
+    indices = struct.pack(
+        "<36H",
+        *(0, 2, 1, 1, 2, 3, 4, 5, 6, 5, 7, 6, 0, 1, 4, 1, 5, 4),
+        *(2, 6, 3, 3, 6, 7, 0, 4, 2, 2, 4, 6, 1, 3, 5, 3, 7, 5),
+    )
+    bin_path = path.with_suffix(".bin")
+    bin_path.write_bytes(positions + indices)
+
+    side = math.ceil(math.sqrt(PART_COUNT))
+    gltf = {
+        "asset": {"version": "2.0"},
+        "scene": 0,
+        "scenes": [{"nodes": list(range(PART_COUNT))}],
+        "nodes": [
+            {"mesh": i, "translation": [1.5 * (i % side), 1.5 * (i // side), 0.0]}
+            for i in range(PART_COUNT)
+        ],
+        "meshes": [
+            {"primitives": [{"attributes": {"POSITION": 0}, "indices": 1}]}
+            for _ in range(PART_COUNT)
+        ],
+        "buffers": [{"uri": bin_path.name, "byteLength": len(positions) + len(indices)}],
+        "bufferViews": [
+            {"buffer": 0, "byteOffset": 0, "byteLength": len(positions), "target": 34962},
+            {
+                "buffer": 0,
+                "byteOffset": len(positions),
+                "byteLength": len(indices),
+                "target": 34963,
+            },
+        ],
+        "accessors": [
+            {
+                "bufferView": 0,
+                "componentType": 5126,
+                "count": 8,
+                "type": "VEC3",
+                "min": [0.0, 0.0, 0.0],
+                "max": [1.0, 1.0, 1.0],
+            },
+            {"bufferView": 1, "componentType": 5123, "count": 36, "type": "SCALAR"},
+        ],
+    }
+    path.write_text(json.dumps(gltf))
+
+
+def generate_volume(path: Path) -> None:
+    """MetaImage of unsigned char voxels, the sum of a sine wave along each axis"""
+    n = VOLUME_RESOLUTION
+    wave = [int(42.5 * (1 + math.sin(8 * math.pi * i / n))) for i in range(n)]
+    row = bytes(wave)
+
+    # Each row is the X wave shifted by the Y and Z waves, shifted with translation tables
+    shifts = [bytes(min(v + s, 255) for v in range(256)) for s in range(2 * 85 + 1)]
+    raw_path = path.with_suffix(".raw")
+    with open(raw_path, "wb") as f:
+        for k in range(n):
+            f.write(b"".join(row.translate(shifts[wave[j] + wave[k]]) for j in range(n)))
+
+    path.write_text(
+        "ObjectType = Image\n"
+        "NDims = 3\n"
+        f"DimSize = {n} {n} {n}\n"
+        "ElementSpacing = 1 1 1\n"
+        "ElementType = MET_UCHAR\n"
+        f"ElementDataFile = {raw_path.name}\n"
+    )
+
+
+def main() -> int:
+    if len(sys.argv) != 2:
+        print(__doc__)
+        return 1
+
+    output = Path(sys.argv[1])
+    output.mkdir(parents=True, exist_ok=True)
+
+    generators = {
+        "large_mesh.ply": generate_mesh,
+        "splats.splat": generate_splats,
+        "assembly.gltf": generate_assembly,
+        "volume.mhd": generate_volume,
+    }
+    for name, generator in generators.items():
+        path = output / name
+        if path.exists():
+            print(f"{path} already exists")
+            continue
+        print(f"Generating {path}")
+        # Generate in a temporary file so an interrupted generation is not considered complete
+        temporary = path.with_name(name + ".tmp")
+        generator(temporary)
+        temporary.replace(path)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,37 @@
+## Benchmarks, measuring the performance on large generated scenes with --benchmark
+# The results are saved as JSON files in Testing/Temporary/benchmark
+find_package(Python3 COMPONENTS Interpreter)
+if(NOT Python3_Interpreter_FOUND)
+  message(WARNING "Python interpreter not found, benchmarks are disabled")
+  return()
+endif()
+
+set(_f3d_benchmark_dir "${CMAKE_BINARY_DIR}/Testing/Temporary/benchmark")
+
+add_test(NAME f3d::BenchmarkGenerateScenes COMMAND ${Python3_EXECUTABLE} ${CMAKE_CURRENT_SOURCE_DIR}/generate_benchmark_scenes.py ${_f3d_benchmark_dir})
+set_tests_properties(f3d::BenchmarkGenerateScenes PROPERTIES LABELS "benchmark" TIMEOUT 600)
+
+function(f3d_benchmark_test)
+  cmake_parse_arguments(F3D_BENCHMARK "" "NAME" "DATA;ARGS" ${ARGN})
+  f3d_test(NAME ${F3D_BENCHMARK_NAME} DATA ${F3D_BENCHMARK_DATA} RESOLUTION 1920,1080 NO_BASELINE NO_OUTPUT DEPENDS BenchmarkGenerateScenes LABELS benchmark
+    ARGS --benchmark=${_f3d_benchmark_dir}/${F3D_BENCHMARK_NAME}.json ${F3D_BENCHMARK_ARGS})
+  set_tests_properties(f3d::${F3D_BENCHMARK_NAME} PROPERTIES TIMEOUT 600 RUN_SERIAL TRUE)
+endfunction()
+
+f3d_benchmark_test(NAME BenchmarkLargeMesh DATA ${_f3d_benchmark_dir}/large_mesh.ply)
+# Splat sorting needs compute shaders, not supported on macOS
+if(APPLE)
+  set(_f3d_benchmark_splat_blending "stochastic")
+else()
+  set(_f3d_benchmark_splat_blending "sort")
+endif()
+f3d_benchmark_test(NAME BenchmarkSplats DATA ${_f3d_benchmark_dir}/splats.splat ARGS -sy --point-sprites-absolute-size --point-sprites-size=1 --point-sprites=gaussian --blending=${_f3d_benchmark_splat_blending})
+f3d_benchmark_test(NAME BenchmarkAssembly DATA ${_f3d_benchmark_dir}/assembly.gltf)
+f3d_benchmark_test(NAME BenchmarkVolume DATA ${_f3d_benchmark_dir}/volume.mhd ARGS --volume)
+f3d_benchmark_test(NAME BenchmarkSkinnedAnimation DATA ${F3D_SOURCE_DIR}/testing/data/RiggedFigure.glb)
+
+# Run all the benchmarks with "cmake --build . --target benchmark"
+add_custom_target(benchmark
+  COMMAND ${CMAKE_CTEST_COMMAND} -L benchmark --output-on-failure
+  WORKING_DIRECTORY ${CMAKE_BINARY_DIR}
+  USES_TERMINAL)
@@ -570,6 +570,19 @@ f3d_test(NAME TestVerboseGrid DATA suzanne.ply ARGS -g --verbose REGEXP "Grid or
 # Test bounding box no render output
 f3d_test(NAME TestNoRenderBBox DATA suzanne.ply NO_RENDER REGEXP "Scene bounding box: -1.32819 ≤ x ≤ 1.32819, -0.971822 ≤ y ≤ 0.939236, -0.778266 ≤ z ≤ 0.822441")
 
+# Test load trace output
+f3d_test(NAME TestNoRenderTrace DATA suzanne.ply ARGS --trace=${CMAKE_BINARY_DIR}/Testing/Temporary/TestNoRenderTrace.json NO_RENDER REGEXP "Trace saved to")
+add_test(
+  NAME f3d::TestNoRenderTraceContent
+  COMMAND ${CMAKE_COMMAND}
+    -DF3D_TRACE_FILE=${CMAKE_BINARY_DIR}/Testing/Temporary/TestNoRenderTrace.json
+    -P ${CMAKE_CURRENT_SOURCE_DIR}/f3d_trace.cmake)
+set_tests_properties(f3d::TestNoRenderTrace PROPERTIES FIXTURES_SETUP f3d::TestNoRenderTrace_FIXTURE)
+set_tests_properties(f3d::TestNoRenderTraceContent PROPERTIES FIXTURES_REQUIRED f3d::TestNoRenderTrace_FIXTURE)
+
+# Test memory budget warning
+f3d_test(NAME TestNoRenderMemoryBudget DATA suzanne.ply ARGS --memory-budget=0 NO_RENDER REGEXP "exceeds the memory budget")
+
 # Test Scalars coloring verbose output
 f3d_test(NAME TestVerboseScalars DATA suzanne.ply ARGS -s --verbose REGEXP "Coloring using point array named Normals, Magnitude." NO_BASELINE)
 
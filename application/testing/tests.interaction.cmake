@@ -5,11 +5,11 @@ f3d_test(NAME TestInteractionTimer DATA cow.vtp NO_BASELINE INTERACTION UI LONG_
 f3d_test(NAME TestInteractionTrackball DATA cow.vtp ARGS --interaction-style=trackball INTERACTION LONG_TIMEOUT) #Mouse movements;
 f3d_test(NAME TestInteractionTrackballBind DATA cow.vtp INTERACTION LONG_TIMEOUT) #K#Mouse movements;
 f3d_test(NAME TestInteractionCycleCell DATA waveletArrays.vti INTERACTION LONG_TIMEOUT) #VCCC
-f3d_test(NAME TestInteractionCycleComp DATA dragon.vtu INTERACTION) #SYYYY
-f3d_test(NAME TestInteractionCycleScalars DATA dragon.vtu INTERACTION) #BSSSS
+f3d_test(NAME TestInteractionCycleComp DATA dragon.vtu INTERACTION_FAST) #SYYYY
+f3d_test(NAME TestInteractionCycleScalars DATA dragon.vtu INTERACTION_FAST) #BSSSS
 f3d_test(NAME TestInteractionCycleCellInvalidIndex DATA waveletArrays.vti INTERACTION) #SSC
 f3d_test(NAME TestInteractionCycleBlending DATA suzanne.ply ARGS --opacity=0.8 INTERACTION LONG_TIMEOUT) #PPPPP # Cycle to ddp
-f3d_test(NAME TestInteractionVolumeCycle DATA waveletArrays.vti ARGS INTERACTION) #VSS
+f3d_test(NAME TestInteractionVolumeCycle DATA waveletArrays.vti ARGS INTERACTION_FAST) #VSS
 f3d_test(NAME TestInteractionVolumeAfterColoring DATA waveletArrays.vti ARGS INTERACTION) #SSSV
 f3d_test(NAME TestInteractionVolumeInverse DATA HeadMRVolume.mhd ARGS --camera-position=127.5,-400,127.5 --camera-view-up=0,0,1 INTERACTION THRESHOLD 0.05) #VI #Small rendering differences due to volume rendering
 f3d_test(NAME TestInteractionCorrectCameraForVolumeSwitch ARGS --no-config -v DATA dragon.vtu INTERACTION UI) #v
@@ -19,8 +19,8 @@ f3d_test(NAME TestInteractionDirectory DATA mb INTERACTION ARGS --scalar-colorin
 f3d_test(NAME TestInteractionDirectoryLoop DATA mb/recursive INTERACTION ARGS --scalar-coloring --filename UI) #Left;Left;Left;Left;Left;
 f3d_test(NAME TestInteractionDirectoryEmpty DATA mb INTERACTION NO_DATA_FORCE_RENDER UI) #Right;Right;Right;
 f3d_test(NAME TestInteractionDirectoryEmptyVerbose DATA mb ARGS --verbose NO_BASELINE INTERACTION REGEXP "is of an unknown format") #Right;Right;Right;HMCSY
-f3d_test(NAME TestInteractionTensorsCycleComp DATA tensors.vti ARGS --scalar-coloring --coloring-component=-2 INTERACTION) #SYYYYYYYYYY
-f3d_test(NAME TestInteractionCycleScalarsCompCheck DATA dragon.vtu ARGS -b --scalar-coloring --coloring-component=2 INTERACTION) #S
+f3d_test(NAME TestInteractionTensorsCycleComp DATA tensors.vti ARGS --scalar-coloring --coloring-component=-2 INTERACTION_FAST) #SYYYYYYYYYY
+f3d_test(NAME TestInteractionCycleScalarsCompCheck DATA dragon.vtu ARGS -b --scalar-coloring --coloring-component=2 INTERACTION_FAST) #S
 f3d_test(NAME TestInteractionTAA DATA suzanne.ply ARGS --anti-aliasing=taa INTERACTION) #Render;Render...
 f3d_test(NAME TestInteractionTAAMiddleClick DATA suzanne.ply ARGS --anti-aliasing=taa INTERACTION) #Render;Render...;MiddleClick;Render;Render...
 f3d_test(NAME TestInteractionCycleVerbose DATA dragon.vtu ARGS --verbose -s NO_BASELINE INTERACTION REGEXP "Not coloring") #SSSSYC
@@ -33,7 +33,7 @@ f3d_test(NAME TestInteractionReload DATA dragon.vtu ARGS -e INTERACTION) #Up;
 f3d_test(NAME TestInteractionLoadParentDirectory DATA multi/dragon.vtu ARGS --filename INTERACTION UI) #Down;
 f3d_test(NAME TestInteractionEmptyLoadParentDirectory INTERACTION NO_BASELINE REGEXP "No files loaded, no rendering performed") #Down;
 f3d_test(NAME TestInteractionMultiFileLoadParentDirectory DATA mb/mb_0_0.vtu ARGS --multi-file-mode=all --filename INTERACTION UI) #Down;
-f3d_test(NAME TestInteractionInvertZoom DATA suzanne.ply ARGS --invert-zoom INTERACTION)
+f3d_test(NAME TestInteractionInvertZoom DATA suzanne.ply ARGS --invert-zoom INTERACTION_FAST)
 f3d_test(NAME TestInteractionSimpleExit DATA cow.vtp REGEXP "Interactor has been stopped" INTERACTION NO_BASELINE) #CTRL+Q
 f3d_test(NAME TestInteractionNotifications DATA cow.vtp ARGS --notifications INTERACTION UI) #E;
 f3d_test(NAME TestInteractionNotificationsUpdate DATA cow.vtp ARGS --notifications INTERACTION UI) #E;E;Up;Up
@@ -91,14 +91,14 @@ if(VTK_VERSION VERSION_GREATER_EQUAL 9.5.20251001)
 endif()
 
 ## 2D Mode
-f3d_test(NAME TestInteraction2DPan DATA cow.vtp ARGS --interaction-style=2d INTERACTION) #LeftMouse;MouseMovements
-f3d_test(NAME TestInteraction2DZoom DATA cow.vtp ARGS --interaction-style=2d INTERACTION) #RightMouse;MouseMovements
-f3d_test(NAME TestInteraction2DCycle DATA cow.vtp INTERACTION) #K;K;LeftMouse;MouseMovements
+f3d_test(NAME TestInteraction2DPan DATA cow.vtp ARGS --interaction-style=2d INTERACTION_FAST) #LeftMouse;MouseMovements
+f3d_test(NAME TestInteraction2DZoom DATA cow.vtp ARGS --interaction-style=2d INTERACTION_FAST) #RightMouse;MouseMovements
+f3d_test(NAME TestInteraction2DCycle DATA cow.vtp INTERACTION_FAST) #K;K;LeftMouse;MouseMovements
 
 ## Camera
 f3d_test(NAME TestInteractionResetCamera DATA dragon.vtu INTERACTION LONG_TIMEOUT) #MouseMovements;Return;
 f3d_test(NAME TestInteractionResetCameraWithCameraIndex DATA CameraAnimated.glb ARGS --camera-index=0 INTERACTION) #MouseMovements;Return;
-f3d_test(NAME TestInteractionCameraUpdate DATA dragon.vtu INTERACTION) #MouseWheel;MouseWheel;MouseWheel;S
+f3d_test(NAME TestInteractionCameraUpdate DATA dragon.vtu INTERACTION_FAST) #MouseWheel;MouseWheel;MouseWheel;S
 f3d_test(NAME TestInteractionFocalPointPickingDefault DATA dragon.vtu INTERACTION LONG_TIMEOUT)
 f3d_test(NAME TestInteractionFocalPointPickingShift DATA dragon.vtu INTERACTION LONG_TIMEOUT)
 f3d_test(NAME TestInteractionFocalPointPickingPoints DATA pointsCloud.vtp INTERACTION THRESHOLD 0.05) # Threshold needed because sometime a point does not appear
@@ -111,15 +111,16 @@ endif()
 f3d_test(NAME TestInteractionVerticalDragRotate DATA dragon.vtu ARGS --up=y INTERACTION LONG_TIMEOUT) # 7 (top-view); left click and drag
 f3d_test(NAME TestInteractionInitUpVectorOption DATA dragon.vtu ARGS --up=-Y INTERACTION LONG_TIMEOUT) #Small drag left, camera should maintain orientation
 f3d_test(NAME TestInteractionDynamicUpDirection DATA dragon.vtu INTERACTION) # Ctrl+Z
-f3d_test(NAME TestInteractionCameraHotkeys DATA cow.vtp INTERACTION)
+f3d_test(NAME TestInteractionCameraHotkeys DATA cow.vtp INTERACTION_FAST)
+f3d_test(NAME TestInteractionCameraHotkeysBinary DATA cow.vtp ARGS --interaction-test-play=${F3D_SOURCE_DIR}/testing/recordings/TestInteractionCameraHotkeysBinary.f3drec --interaction-test-fast BASELINE_PATH ${F3D_SOURCE_DIR}/testing/baselines/TestInteractionCameraHotkeys.png) # Same recording as TestInteractionCameraHotkeys in the binary format
 f3d_test(NAME TestInteractionZoomToMouse DATA cow.vtp INTERACTION)
 f3d_test(NAME TestInteractionOrthographicProjection DATA cow.vtp INTERACTION) #5;5
 f3d_test(NAME TestInteractionZoomToggleOrthographicProjection DATA cow.vtp INTERACTION) #MouseWheel;5;Mousewheelx6;5
-f3d_test(NAME TestInteractionRotateCameraMinus90 DATA f3d.glb INTERACTION)
-f3d_test(NAME TestInteractionRotateCamera90 DATA f3d.glb INTERACTION)
-f3d_test(NAME TestInteractionRollCameraRotation DATA f3d.glb ARGS -g INTERACTION) #1;4;LeftMouse;MouseMovements
-f3d_test(NAME TestInteractionElevationCameraRotation DATA f3d.glb ARGS -g INTERACTION THRESHOLD 0.06) #8;8;2 # Threshold is needed because camera seems to move slightly differently sometimes
-f3d_test(NAME TestInteractionPanWithShift DATA f3d.glb INTERACTION) #Shift;LeftMouse;MouseMovements
+f3d_test(NAME TestInteractionRotateCameraMinus90 DATA f3d.glb INTERACTION_FAST)
+f3d_test(NAME TestInteractionRotateCamera90 DATA f3d.glb INTERACTION_FAST)
+f3d_test(NAME TestInteractionRollCameraRotation DATA f3d.glb ARGS -g INTERACTION_FAST) #1;4;LeftMouse;MouseMovements
+f3d_test(NAME TestInteractionElevationCameraRotation DATA f3d.glb ARGS -g INTERACTION_FAST THRESHOLD 0.06) #8;8;2 # Threshold is needed because camera seems to move slightly differently sometimes
+f3d_test(NAME TestInteractionPanWithShift DATA f3d.glb INTERACTION_FAST) #Shift;LeftMouse;MouseMovements
 
 # Test camera preserving/resetting when switching files in interaction mode
 f3d_test(NAME TestInteractionSwitchFileNoCameraKeeping DATA cow.vtp cowlow.vtp INTERACTION)
@@ -0,0 +1,22 @@
+## Custom test for server CLI option
+# Two valid jobs with different options, a job with a missing file and a job printing the help, then quit
+set(_f3d_server_dir "${CMAKE_BINARY_DIR}/Testing/Temporary")
+set(_f3d_server_outputs "${_f3d_server_dir}/TestServerCow.png|${_f3d_server_dir}/TestServerDragon.png")
+file(WRITE "${CMAKE_BINARY_DIR}/testing/TestServerJobs.txt"
+  "--output=${_f3d_server_dir}/TestServerCow.png \"${F3D_SOURCE_DIR}/testing/data/cow.vtp\"\n"
+  "--resolution=200,100 --edges --output=${_f3d_server_dir}/TestServerDragon.png \"${F3D_SOURCE_DIR}/testing/data/dragon.vtu\"\n"
+  "--output=${_f3d_server_dir}/TestServerMissing.png \"${F3D_SOURCE_DIR}/testing/data/missing.vtp\"\n"
+  "--help\n"
+  "quit\n")
+
+add_test(
+  NAME f3d::TestServer
+  COMMAND ${CMAKE_COMMAND}
+    -DF3D_EXE:FILEPATH=$<TARGET_FILE:f3d>
+    -DF3D_SERVER_JOBS=${CMAKE_BINARY_DIR}/testing/TestServerJobs.txt
+    "-DF3D_SERVER_OUTPUTS=${_f3d_server_outputs}"
+    -P ${CMAKE_CURRENT_SOURCE_DIR}/f3d_server.cmake)
+set_tests_properties(f3d::TestServer PROPERTIES TIMEOUT 30)
+if(NOT F3D_TESTING_ENABLE_RENDERING_TESTS)
+  set_tests_properties(f3d::TestServer PROPERTIES DISABLED ON)
+endif()
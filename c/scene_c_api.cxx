@@ -1,9 +1,11 @@
 #include "scene_c_api.h"
+#include "mesh_view.h"
 #include "scene.h"
 #include "types.h"
 
 #include <filesystem>
 #include <log.h>
+#include <memory>
 #include <vector>
 
 namespace
@@ -116,6 +118,91 @@ f3d::mesh_t to_cpp_mesh(const f3d_mesh_t* c_mesh)
 
   return cpp_mesh;
 }
+
+//----------------------------------------------------------------------------
+f3d::mesh_view::data_array_t to_cpp_data_array(const f3d_mesh_data_array_t& c_array)
+{
+  f3d::mesh_view::data_array_t cpp_array;
+  cpp_array.name = c_array.name ? c_array.name : "";
+  cpp_array.type = static_cast<f3d::mesh_view::data_type>(c_array.type);
+  cpp_array.data = c_array.data;
+  cpp_array.components = c_array.components > 0 ? c_array.components : 1;
+  cpp_array.stride = c_array.stride > 0 ? c_array.stride : cpp_array.components;
+  cpp_array.timeDependent = c_array.time_dependent != 0;
+  return cpp_array;
+}
+
+//----------------------------------------------------------------------------
+f3d::mesh_view::cell_array_t to_cpp_cell_array(const f3d_mesh_cell_array_t& c_cells)
+{
+  f3d::mesh_view::cell_array_t cpp_cells;
+  cpp_cells.offsetCount = c_cells.offset_count > 0 ? c_cells.offset_count : 1;
+  cpp_cells.offsets = to_cpp_data_array(c_cells.offsets);
+  cpp_cells.indexCount = c_cells.index_count;
+  cpp_cells.indices = to_cpp_data_array(c_cells.indices);
+  return cpp_cells;
+}
+
+/**
+ * A mesh_view forwarding to the C callbacks, only the array descriptions are converted,
+ * the data itself is never copied
+ */
+class c_mesh_view : public f3d::mesh_view
+{
+public:
+  explicit c_mesh_view(const f3d_mesh_view_t& view)
+    : View(view)
+    , Name(view.name ? view.name : "")
+  {
+  }
+
+  ~c_mesh_view() override
+  {
+    if (this->View.release)
+    {
+      this->View.release(this->View.user_data);
+    }
+  }
+
+  [[nodiscard]] std::array<double, 2> getTimeRange() const override
+  {
+    return { this->View.time_range[0], this->View.time_range[1] };
+  }
+
+  [[nodiscard]] std::string getName() const override
+  {
+    return this->Name;
+  }
+
+  [[nodiscard]] memory_view_t getMemoryView(double time) const override
+  {
+    f3d_mesh_memory_view_t c_view = {};
+    this->View.get_memory_view(time, &c_view, this->View.user_data);
+
+    memory_view_t cpp_view;
+    cpp_view.pointCount = c_view.point_count;
+    cpp_view.points = to_cpp_data_array(c_view.points);
+    cpp_view.normals = to_cpp_data_array(c_view.normals);
+    cpp_view.textureCoordinates = to_cpp_data_array(c_view.texture_coordinates);
+    cpp_view.vertices = to_cpp_cell_array(c_view.vertices);
+    cpp_view.lines = to_cpp_cell_array(c_view.lines);
+    cpp_view.polygons = to_cpp_cell_array(c_view.polygons);
+
+    for (size_t i = 0; c_view.point_scalars && i < c_view.point_scalars_count; ++i)
+    {
+      cpp_view.pointScalars.emplace_back(to_cpp_data_array(c_view.point_scalars[i]));
+    }
+    for (size_t i = 0; c_view.cell_scalars && i < c_view.cell_scalars_count; ++i)
+    {
+      cpp_view.cellScalars.emplace_back(to_cpp_data_array(c_view.cell_scalars[i]));
+    }
+    return cpp_view;
+  }
+
+private:
+  f3d_mesh_view_t View;
+  std::string Name;
+};
 }
 
 //----------------------------------------------------------------------------
@@ -221,6 +308,36 @@ int f3d_scene_add_mesh(f3d_scene_t* scene, const f3d_mesh_t* mesh)
   return 1;
 }
 
+//----------------------------------------------------------------------------
+int f3d_scene_add_mesh_view(f3d_scene_t* scene, const f3d_mesh_view_t* mesh_view)
+{
+  if (!mesh_view)
+  {
+    return 0;
+  }
+
+  // Owning the mesh view right away ensures release is called on every path
+  std::shared_ptr<f3d::mesh_view> cpp_mesh_view = std::make_shared<c_mesh_view>(*mesh_view);
+  if (!scene || !mesh_view->get_memory_view)
+  {
+    return 0;
+  }
+
+  f3d::scene* cpp_scene = reinterpret_cast<f3d::scene*>(scene);
+
+  try
+  {
+    cpp_scene->add(std::move(cpp_mesh_view));
+  }
+  catch (const f3d::scene::load_failure_exception& e)
+  {
+    f3d::log::error("Failed to add mesh view to scene: ", e.what());
+    return 0;
+  }
+
+  return 1;
+}
+
 //----------------------------------------------------------------------------
 int f3d_scene_add_buffer(f3d_scene_t* scene, void* buffer, size_t size)
 {
@@ -44,6 +44,18 @@ extern "C"
    */
   F3D_EXPORT int f3d_scene_add_mesh(f3d_scene_t* scene, const f3d_mesh_t* mesh);
 
+  /**
+   * @brief Add and load a mesh view into the scene, without copying its data.
+   *
+   * The mesh_view structure is copied, its release callback, if any, is called when the
+   * mesh is not used anymore, including on failure.
+   *
+   * @param scene Scene handle.
+   * @param mesh_view Mesh view structure.
+   * @return 1 on success, 0 on failure.
+   */
+  F3D_EXPORT int f3d_scene_add_mesh_view(f3d_scene_t* scene, const f3d_mesh_view_t* mesh_view);
+
   /**
    * @brief Add and load a memory buffer into the scene.
    *
@@ -0,0 +1,203 @@
+#include <camera_c_api.h>
+#include <engine_c_api.h>
+#include <image_c_api.h>
+#include <scene_c_api.h>
+#include <types_c_api.h>
+#include <window_c_api.h>
+
+#include <stdio.h>
+
+typedef struct triangle_data_t
+{
+  float points[9];
+  unsigned int offsets[2];
+  unsigned int indices[3];
+  float scalars[1];
+  f3d_mesh_data_array_t cell_scalars[1];
+  int get_count;
+  int release_count;
+  int valid;
+} triangle_data_t;
+
+static void get_triangle_view(double time, f3d_mesh_memory_view_t* view, void* user_data)
+{
+  triangle_data_t* data = (triangle_data_t*)user_data;
+  data->get_count++;
+
+  if (!data->valid)
+  {
+    // Leave the memory view empty, which is invalid
+    return;
+  }
+
+  // Move the triangle with time, the caller memory is used as is
+  data->points[2] = (float)time;
+  data->scalars[0] = (float)time;
+
+  view->point_count = 3;
+  view->points.type = F3D_MESH_DATA_TYPE_F32;
+  view->points.data = data->points;
+  view->points.components = 3;
+  view->points.time_dependent = 1;
+
+  view->polygons.offset_count = 2;
+  view->polygons.offsets.type = F3D_MESH_DATA_TYPE_U32;
+  view->polygons.offsets.data = data->offsets;
+  view->polygons.index_count = 3;
+  view->polygons.indices.type = F3D_MESH_DATA_TYPE_U32;
+  view->polygons.indices.data = data->indices;
+
+  data->cell_scalars[0].name = "time";
+  data->cell_scalars[0].type = F3D_MESH_DATA_TYPE_F32;
+  data->cell_scalars[0].data = data->scalars;
+  data->cell_scalars[0].time_dependent = 1;
+  view->cell_scalars = data->cell_scalars;
+  view->cell_scalars_count = 1;
+}
+
+static void get_static_triangle_view(double time, f3d_mesh_memory_view_t* view, void* user_data)
+{
+  (void)time;
+  triangle_data_t* data = (triangle_data_t*)user_data;
+  data->get_count++;
+
+  view->point_count = 3;
+  view->points.type = F3D_MESH_DATA_TYPE_F32;
+  view->points.data = data->points;
+  view->points.components = 3;
+  view->points.time_dependent = 0;
+
+  view->polygons.offset_count = 2;
+  view->polygons.offsets.type = F3D_MESH_DATA_TYPE_U32;
+  view->polygons.offsets.data = data->offsets;
+  view->polygons.index_count = 3;
+  view->polygons.indices.type = F3D_MESH_DATA_TYPE_U32;
+  view->polygons.indices.data = data->indices;
+}
+
+static void release_triangle(void* user_data)
+{
+  triangle_data_t* data = (triangle_data_t*)user_data;
+  data->release_count++;
+}
+
+int test_scene_mesh_view()
+{
+  f3d_engine_t* engine = f3d_engine_create(1);
+  if (!engine)
+  {
+    puts("[ERROR] Failed to create engine");
+    return 1;
+  }
+
+  f3d_scene_t* scene = f3d_engine_get_scene(engine);
+  f3d_window_t* window = f3d_engine_get_window(engine);
+  f3d_window_set_size(window, 300, 300);
+  f3d_image_t* empty_image = f3d_window_render_to_image(window, 0);
+
+  // A static mesh view is not queried again, its memory is used without any copy,
+  // so collapsing its points after it is added leaves nothing to display
+  triangle_data_t static_data = { { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f },
+    { 0, 3 }, { 0, 1, 2 } };
+  f3d_mesh_view_t static_mesh_view = { 0 };
+  static_mesh_view.get_memory_view = get_static_triangle_view;
+  static_mesh_view.user_data = &static_data;
+  static_mesh_view.name = "static triangle";
+
+  if (f3d_scene_add_mesh_view(scene, &static_mesh_view) != 1 || static_data.get_count != 1)
+  {
+    puts("[ERROR] Failed to add a static mesh view");
+    f3d_image_delete(empty_image);
+    f3d_engine_delete(engine);
+    return 1;
+  }
+
+  for (int i = 0; i < 9; i++)
+  {
+    static_data.points[i] = 0.0f;
+  }
+  f3d_image_t* collapsed_image = f3d_window_render_to_image(window, 0);
+  int copied = f3d_image_not_equals(collapsed_image, empty_image);
+  f3d_image_delete(collapsed_image);
+  f3d_image_delete(empty_image);
+  if (copied || static_data.get_count != 1)
+  {
+    puts("[ERROR] Static mesh view memory was copied instead of being used directly");
+    f3d_engine_delete(engine);
+    return 1;
+  }
+  f3d_scene_clear(scene);
+
+  triangle_data_t data = { { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f }, { 0, 3 },
+    { 0, 1, 2 } };
+  data.valid = 1;
+
+  f3d_mesh_view_t mesh_view = { 0 };
+  mesh_view.get_memory_view = get_triangle_view;
+  mesh_view.release = release_triangle;
+  mesh_view.user_data = &data;
+  mesh_view.time_range[1] = 1.0;
+  mesh_view.name = "triangle";
+
+  if (f3d_scene_add_mesh_view(scene, &mesh_view) != 1 || data.get_count < 1)
+  {
+    puts("[ERROR] Failed to add a mesh view");
+    f3d_engine_delete(engine);
+    return 1;
+  }
+
+  // A time dependent mesh view is queried again at each animation time,
+  // so a change made by the caller outside of the callback is displayed
+  data.points[3] = 3.0f;
+  int get_count = data.get_count;
+  f3d_scene_load_animation_time(scene, 0.5);
+  if (data.get_count <= get_count || data.release_count != 0)
+  {
+    puts("[ERROR] Mesh view not updated at animation time");
+    f3d_engine_delete(engine);
+    return 1;
+  }
+
+  // The bounds are now [0, 3] x [0, 1] x [0, 0.5]
+  f3d_window_render(window);
+  f3d_camera_t* camera = f3d_window_get_camera(window);
+  f3d_camera_reset_to_bounds(camera, 0.9);
+  f3d_point3_t focal;
+  f3d_camera_get_focal_point(camera, focal);
+  double dx = focal[0] - 1.5;
+  double dz = focal[2] - 0.25;
+  if (dx * dx > 1e-10 || dz * dz > 1e-10)
+  {
+    puts("[ERROR] Mesh view change not displayed at animation time");
+    f3d_engine_delete(engine);
+    return 1;
+  }
+
+  // An invalid mesh view fails but is still released
+  triangle_data_t invalid_data = { 0 };
+  f3d_mesh_view_t invalid_mesh_view = mesh_view;
+  invalid_mesh_view.user_data = &invalid_data;
+  if (f3d_scene_add_mesh_view(scene, &invalid_mesh_view) != 0 || invalid_data.release_count != 1)
+  {
+    puts("[ERROR] Invalid mesh view not handled");
+    f3d_engine_delete(engine);
+    return 1;
+  }
+
+  if (f3d_scene_add_mesh_view(scene, NULL) != 0)
+  {
+    puts("[ERROR] Null mesh view not handled");
+    f3d_engine_delete(engine);
+    return 1;
+  }
+
+  // The mesh view is released once the scene does not use it anymore
+  f3d_engine_delete(engine);
+  if (data.release_count != 1)
+  {
+    puts("[ERROR] Mesh view not released");
+    return 1;
+  }
+
+  return 0;
+}
@@ -160,6 +160,93 @@ extern "C"
    */
   F3D_EXPORT int f3d_mesh_is_valid(const f3d_mesh_t* mesh, char** error_message);
 
+  /**
+   * @brief Enumeration of data types supported by a mesh view.
+   */
+  typedef enum f3d_mesh_data_type_t
+  {
+    F3D_MESH_DATA_TYPE_U8 = 0,
+    F3D_MESH_DATA_TYPE_I8 = 1,
+    F3D_MESH_DATA_TYPE_U16 = 2,
+    F3D_MESH_DATA_TYPE_I16 = 3,
+    F3D_MESH_DATA_TYPE_U32 = 4,
+    F3D_MESH_DATA_TYPE_I32 = 5,
+    F3D_MESH_DATA_TYPE_U64 = 6,
+    F3D_MESH_DATA_TYPE_I64 = 7,
+    F3D_MESH_DATA_TYPE_F32 = 8,
+    F3D_MESH_DATA_TYPE_F64 = 9
+  } f3d_mesh_data_type_t;
+
+  /**
+   * @brief Describe a view of an existing data array.
+   *
+   * The data is not copied, the pointer must remain valid while the mesh is used in the scene.
+   * A components or stride of 0 defaults to 1 component and a stride equal to the number of
+   * components. stride is expressed in number of elements, not bytes.
+   * time_dependent must be set to a non-zero value if the data can change over time.
+   */
+  typedef struct f3d_mesh_data_array_t
+  {
+    const char* name;
+    f3d_mesh_data_type_t type;
+    const void* data;
+    size_t components;
+    size_t stride;
+    int time_dependent;
+  } f3d_mesh_data_array_t;
+
+  /**
+   * @brief Describe a view of a cell array.
+   *
+   * offset_count must be equal to the number of cells + 1, or 0 or 1 if there is no cell.
+   */
+  typedef struct f3d_mesh_cell_array_t
+  {
+    size_t offset_count;
+    f3d_mesh_data_array_t offsets;
+    size_t index_count;
+    f3d_mesh_data_array_t indices;
+  } f3d_mesh_cell_array_t;
+
+  /**
+   * @brief Describe a view of a mesh in memory at a given time.
+   *
+   * See f3d::mesh_view::memory_view_t for the constraints on each array.
+   */
+  typedef struct f3d_mesh_memory_view_t
+  {
+    size_t point_count;
+    f3d_mesh_data_array_t points;
+    f3d_mesh_data_array_t normals;
+    f3d_mesh_data_array_t texture_coordinates;
+
+    f3d_mesh_cell_array_t vertices;
+    f3d_mesh_cell_array_t lines;
+    f3d_mesh_cell_array_t polygons;
+
+    const f3d_mesh_data_array_t* point_scalars;
+    size_t point_scalars_count;
+    const f3d_mesh_data_array_t* cell_scalars;
+    size_t cell_scalars_count;
+  } f3d_mesh_memory_view_t;
+
+  /**
+   * @brief Describe a mesh provided as views of memory owned by the caller.
+   *
+   * get_memory_view is called with a zero-initialized memory view to fill, each time the mesh
+   * is needed at a given time. The memory it points to is used directly, without any copy.
+   * release is optional and called once the mesh is not used by the scene anymore,
+   * it is the right place to free the memory and user_data.
+   */
+  typedef struct f3d_mesh_view_t
+  {
+    void (*get_memory_view)(double time, f3d_mesh_memory_view_t* memory_view, void* user_data);
+    void (*release)(void* user_data);
+    void* user_data;
+    double time_range[2];
+    const char* name;
+  } f3d_mesh_view_t;
+
   /**
    * @brief Enumeration of light types.
    */
@@ -76,6 +76,7 @@ function (f3d_generate_options)
   list(JOIN _options_lister ",\n  " _options_lister)
   list(JOIN _options_is_optional ";\n  else " _options_is_optional)
   list(JOIN _options_reset ";\n  else " _options_reset)
+  list(JOIN _options_is_same ";\n  else " _options_is_same)
 
   configure_file(
     "${_f3d_generate_options_INPUT_PUBLIC_HEADER}"
@@ -211,6 +212,7 @@ function(_parse_json_option _top_json)
        list(APPEND _options_string_setter "if (name == \"${_option_name}\") opt.${_option_name} = options_tools::parse<${_option_actual_type}>(str)")
        list(APPEND _options_string_getter "if (name == \"${_option_name}\") return options_tools::format(opt.${_option_name}${_optional_getter})")
        list(APPEND _options_lister "\"${_option_name}\"")
+       list(APPEND _options_is_same "if (name == \"${_option_name}\") return opt.${_option_name} == other.${_option_name}")
 
     else()
       # Group found, add in the struct and recurse
@@ -219,8 +221,25 @@ function(_parse_json_option _top_json)
       string(APPEND _option_indent "  ")
       string(APPEND _option_basename "${_member_name}.")
       string(APPEND _options_struct "${_option_indent}struct ${_member_name} {\n")
+      list(LENGTH _options_lister _option_group_start)
       _parse_json_option(${_cur_json})
       string(APPEND _options_struct "${_option_indent}} ${_member_name};\n\n")
+
+      # A group is the same if all the options it contains are the same
+      list(LENGTH _options_lister _option_group_end)
+      math(EXPR _option_group_length "${_option_group_end} - ${_option_group_start}")
+      list(SUBLIST _options_lister ${_option_group_start} ${_option_group_length} _option_group_names)
+      set(_option_group_comparisons "")
+      foreach(_option_group_quoted_name ${_option_group_names})
+        string(REPLACE "\"" "" _option_group_leaf "${_option_group_quoted_name}")
+        list(APPEND _option_group_comparisons "opt.${_option_group_leaf} == other.${_option_group_leaf}")
+      endforeach()
+      list(JOIN _option_group_comparisons " && " _option_group_comparisons)
+      if (NOT _option_group_comparisons)
+        set(_option_group_comparisons "true")
+      endif ()
+      string(REGEX REPLACE "\\.$" "" _option_group_name "${_option_basename}")
+      list(APPEND _options_is_same "if (name == \"${_option_group_name}\") return ${_option_group_comparisons}")
       set(_option_indent ${_option_previndent})
       set(_option_basename ${_option_prevname})
     endif()
@@ -235,4 +254,5 @@ function(_parse_json_option _top_json)
   set(_options_lister ${_options_lister} PARENT_SCOPE)
   set(_options_is_optional ${_options_is_optional} PARENT_SCOPE)
   set(_options_reset ${_options_reset} PARENT_SCOPE)
+  set(_options_is_same ${_options_is_same} PARENT_SCOPE)
 endfunction()
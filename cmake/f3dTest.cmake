@@ -22,6 +22,8 @@ f3d_test(<NAME> [ARGS...])
     with CMake first.
   - `INTERACTION_CONFIGURE` Same as `INTERACTION`, but the file will be configured
     with CMake first.
+  - `INTERACTION_FAST` Same as `INTERACTION`, but the recording is played as fast as possible
+    using `--interaction-test-fast`, only rendering on its render events.
   - `NO_BASELINE` Mark the test to NOT compare its results against a baseline,
     usually used in conjunction with REGEXP
   - `NO_RENDER` Mark the test to NOT use rendering at all, through the `--no-render` CLI option
@@ -57,7 +59,7 @@ f3d_test(<NAME> [ARGS...])
 
 function(f3d_test)
 
-  cmake_parse_arguments(F3D_TEST "LONG_TIMEOUT;DEFAULT_HDRI;INTERACTION;INTERACTION_CONFIGURE;NO_BASELINE;NO_RENDER;NO_OUTPUT;WILL_FAIL;NO_DATA_FORCE_RENDER;UI;SCRIPT" "NAME;BASELINE_PATH;OUTPUT_PATH;CONFIG;RESOLUTION;THRESHOLD;REGEXP;REGEXP_FAIL;HDRI;RENDERING_BACKEND;WORKING_DIR;DPI_SCALE;PIPED;PLUGIN" "DATA;DEPENDS;LABELS;ENV;ARGS" ${ARGN})
+  cmake_parse_arguments(F3D_TEST "LONG_TIMEOUT;DEFAULT_HDRI;INTERACTION;INTERACTION_CONFIGURE;INTERACTION_FAST;NO_BASELINE;NO_RENDER;NO_OUTPUT;WILL_FAIL;NO_DATA_FORCE_RENDER;UI;SCRIPT" "NAME;BASELINE_PATH;OUTPUT_PATH;CONFIG;RESOLUTION;THRESHOLD;REGEXP;REGEXP_FAIL;HDRI;RENDERING_BACKEND;WORKING_DIR;DPI_SCALE;PIPED;PLUGIN" "DATA;DEPENDS;LABELS;ENV;ARGS" ${ARGN})
 
   if(F3D_TEST_CONFIG)
     list(APPEND F3D_TEST_ARGS "--config=${F3D_TEST_CONFIG}")
@@ -81,8 +83,11 @@ function(f3d_test)
     endforeach()
   endif()
 
-  if(F3D_TEST_INTERACTION)
+  if(F3D_TEST_INTERACTION OR F3D_TEST_INTERACTION_FAST)
     list(APPEND F3D_TEST_ARGS "--interaction-test-play=${F3D_SOURCE_DIR}/testing/recordings/${F3D_TEST_NAME}.log")
+    if(F3D_TEST_INTERACTION_FAST)
+      list(APPEND F3D_TEST_ARGS "--interaction-test-fast")
+    endif()
   else ()
     if(F3D_TEST_INTERACTION_CONFIGURE)
       configure_file("${F3D_SOURCE_DIR}/testing/recordings/${F3D_TEST_NAME}.log.in" "${CMAKE_BINARY_DIR}/testing/recordings/${F3D_TEST_NAME}.log")
@@ -2,9 +2,14 @@
 
 #include <app_f3d_F3D_Scene.h>
 
+#include <log.h>
+#include <mesh_view.h>
 #include <scene.h>
 #include <types.h>
 
+#include <algorithm>
+#include <memory>
+
 static std::vector<std::string> JavaListToStringVector(JNIEnv* env, jobject list)
 {
   std::vector<std::string> vec;
@@ -91,6 +96,150 @@ static f3d::mesh_t JavaMeshToCppMesh(JNIEnv* env, jobject jmesh)
   return cppMesh;
 }
 
+// A mesh_view pointing directly to the memory of Java direct buffers.
+// Global references on the buffers are kept so they are not garbage collected while in use.
+class JavaMeshView : public f3d::mesh_view
+{
+public:
+  JavaMeshView(JNIEnv* env, std::string name)
+    : Name(std::move(name))
+  {
+    env->GetJavaVM(&this->VM);
+  }
+
+  ~JavaMeshView() override
+  {
+    // The mesh view may be released from a thread not attached to the JVM, eg: on engine
+    // destruction, attach it temporarily so the buffers can be garbage collected
+    JNIEnv* env = nullptr;
+    bool attached = false;
+    jint status = this->VM->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6);
+    if (status == JNI_EDETACHED)
+    {
+      attached =
+        this->VM->AttachCurrentThread(reinterpret_cast<void**>(&env), nullptr) == JNI_OK;
+      status = attached ? JNI_OK : status;
+    }
+
+    if (status != JNI_OK)
+    {
+      f3d::log::error("Cannot access the JVM, MeshView buffers of \"", this->Name,
+        "\" are not released");
+      return;
+    }
+
+    for (jobject buffer : this->Buffers)
+    {
+      env->DeleteGlobalRef(buffer);
+    }
+
+    if (attached)
+    {
+      this->VM->DetachCurrentThread();
+    }
+  }
+
+  // Point array to the memory of a direct buffer, return false if the buffer is not direct
+  // or not in native byte order, as it could not be used without a copy
+  bool SetDataArray(JNIEnv* env, jobject buffer, f3d::mesh_view::data_type type,
+    size_t components, f3d::mesh_view::data_array_t& array, size_t& count)
+  {
+    count = 0;
+    if (!buffer)
+    {
+      return true;
+    }
+
+    void* data = env->GetDirectBufferAddress(buffer);
+    if (!data)
+    {
+      return false;
+    }
+
+    jclass bufferClass = env->GetObjectClass(buffer);
+    jmethodID orderMethod = env->GetMethodID(bufferClass, "order", "()Ljava/nio/ByteOrder;");
+    jclass byteOrderClass = env->FindClass("java/nio/ByteOrder");
+    jmethodID nativeOrderMethod =
+      env->GetStaticMethodID(byteOrderClass, "nativeOrder", "()Ljava/nio/ByteOrder;");
+    jobject order = env->CallObjectMethod(buffer, orderMethod);
+    jobject nativeOrder = env->CallStaticObjectMethod(byteOrderClass, nativeOrderMethod);
+    if (!env->IsSameObject(order, nativeOrder))
+    {
+      return false;
+    }
+
+    this->Buffers.emplace_back(env->NewGlobalRef(buffer));
+    array.type = type;
+    array.data = data;
+    array.components = components;
+    array.stride = components;
+    array.timeDependent = false;
+    count = static_cast<size_t>(env->GetDirectBufferCapacity(buffer)) / components;
+    return true;
+  }
+
+  [[nodiscard]] std::string getName() const override
+  {
+    return this->Name;
+  }
+
+  [[nodiscard]] memory_view_t getMemoryView(double) const override
+  {
+    return this->View;
+  }
+
+  memory_view_t View;
+
+private:
+  JavaVM* VM = nullptr;
+  std::string Name;
+  std::vector<jobject> Buffers;
+};
+
+static std::shared_ptr<JavaMeshView> JavaMeshViewToCppMeshView(JNIEnv* env, jobject jmeshView)
+{
+  jclass meshViewClass = env->GetObjectClass(jmeshView);
+
+  jfieldID nameField = env->GetFieldID(meshViewClass, "name", "Ljava/lang/String;");
+  jfieldID pointsField = env->GetFieldID(meshViewClass, "points", "Ljava/nio/FloatBuffer;");
+  jfieldID normalsField = env->GetFieldID(meshViewClass, "normals", "Ljava/nio/FloatBuffer;");
+  jfieldID textureCoordinatesField =
+    env->GetFieldID(meshViewClass, "textureCoordinates", "Ljava/nio/FloatBuffer;");
+  jfieldID faceOffsetsField = env->GetFieldID(meshViewClass, "faceOffsets", "Ljava/nio/IntBuffer;");
+  jfieldID faceIndicesField = env->GetFieldID(meshViewClass, "faceIndices", "Ljava/nio/IntBuffer;");
+
+  std::string name;
+  if (jstring jname = static_cast<jstring>(env->GetObjectField(jmeshView, nameField)))
+  {
+    const char* str = env->GetStringUTFChars(jname, nullptr);
+    name = str;
+    env->ReleaseStringUTFChars(jname, str);
+  }
+
+  auto meshView = std::make_shared<JavaMeshView>(env, name);
+  f3d::mesh_view::memory_view_t& view = meshView->View;
+
+  size_t normalsCount = 0;
+  size_t texCoordsCount = 0;
+  size_t faceOffsetsCount = 0;
+  if (!meshView->SetDataArray(env, env->GetObjectField(jmeshView, pointsField),
+        f3d::mesh_view::data_type::F32, 3, view.points, view.pointCount) ||
+    !meshView->SetDataArray(env, env->GetObjectField(jmeshView, normalsField),
+      f3d::mesh_view::data_type::F32, 3, view.normals, normalsCount) ||
+    !meshView->SetDataArray(env, env->GetObjectField(jmeshView, textureCoordinatesField),
+      f3d::mesh_view::data_type::F32, 2, view.textureCoordinates, texCoordsCount) ||
+    !meshView->SetDataArray(env, env->GetObjectField(jmeshView, faceOffsetsField),
+      f3d::mesh_view::data_type::I32, 1, view.polygons.offsets, faceOffsetsCount) ||
+    !meshView->SetDataArray(env, env->GetObjectField(jmeshView, faceIndicesField),
+      f3d::mesh_view::data_type::I32, 1, view.polygons.indices, view.polygons.indexCount))
+  {
+    return nullptr;
+  }
+  view.polygons.offsetCount = std::max<size_t>(faceOffsetsCount, 1);
+
+  return meshView;
+}
+
 static f3d::light_state_t JavaLightStateToCppLightState(JNIEnv* env, jobject jlightState)
 {
   f3d::light_state_t cppLightState;
@@ -255,6 +404,36 @@ extern "C"
     return self;
   }
 
+  JNIEXPORT jobject JAVA_BIND(Scene, addMeshView)(JNIEnv* env, jobject self, jobject meshView)
+  {
+    if (!meshView)
+    {
+      return self;
+    }
+
+    std::shared_ptr<JavaMeshView> cppMeshView = JavaMeshViewToCppMeshView(env, meshView);
+    if (!cppMeshView)
+    {
+      // Never copy silently, direct buffers are the whole point of a mesh view
+      jclass exceptionClass = env->FindClass("java/lang/IllegalArgumentException");
+      env->ThrowNew(
+        exceptionClass, "MeshView buffers must be direct buffers in native byte order");
+      return nullptr;
+    }
+
+    try
+    {
+      GetEngine(env, self)->getScene().add(std::shared_ptr<f3d::mesh_view>(cppMeshView));
+    }
+    catch (const std::exception& e)
+    {
+      jclass exceptionClass = env->FindClass("java/lang/RuntimeException");
+      env->ThrowNew(exceptionClass, e.what());
+      return nullptr;
+    }
+    return self;
+  }
+
   JNIEXPORT jobject JAVA_BIND(Scene, addBuffer)(JNIEnv* env, jobject self, jbyteArray buffer)
   {
     jsize bufferLen = env->GetArrayLength(buffer);
@@ -62,6 +62,20 @@ public class Scene {
         return this.addMesh(mesh);
     }
 
+    private native Scene addMeshView(Types.MeshView meshView);
+
+    /**
+     * Add and load a mesh stored in direct buffers into the scene, without any copy.
+     * A non direct buffer is rejected with an IllegalArgumentException.
+     *
+     * @param meshView mesh view to add
+     * @return this scene for method chaining
+     */
+    public Scene add(Types.MeshView meshView)
+    {
+        return this.addMeshView(meshView);
+    }
+
     /**
      * Add and load a buffer containing a file into the scene.
      *
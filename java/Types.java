@@ -1,5 +1,10 @@
 package app.f3d.F3D;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+import java.nio.IntBuffer;
+
 public class Types {
     // Load the native library
     static {
@@ -133,4 +138,56 @@ public class Types {
             }
         }
     }
+
+    /**
+     * Describes a 3D surfacic mesh stored in direct buffers.
+     * Contrary to Mesh, the buffers are used by the native library without any copy,
+     * so they must be direct buffers in native byte order, see allocateFloatBuffer and
+     * allocateIntBuffer, and must not be modified while the mesh is in the scene.
+     * Buffers are read from their first element up to their capacity.
+     * faceOffsets contains the offset of each face in faceIndices, followed by the total number
+     * of indices.
+     */
+    public static class MeshView {
+        public String name = "";
+        public FloatBuffer points;
+        public FloatBuffer normals;
+        public FloatBuffer textureCoordinates;
+        public IntBuffer faceOffsets;
+        public IntBuffer faceIndices;
+
+        public MeshView() {
+        }
+
+        public MeshView(FloatBuffer points, FloatBuffer normals, FloatBuffer textureCoordinates,
+                   IntBuffer faceOffsets, IntBuffer faceIndices) {
+            this.points = points;
+            this.normals = normals;
+            this.textureCoordinates = textureCoordinates;
+            this.faceOffsets = faceOffsets;
+            this.faceIndices = faceIndices;
+        }
+
+        /**
+         * Allocate a direct float buffer in native byte order, usable in a MeshView.
+         *
+         * @param count number of floats
+         * @return the allocated buffer
+         */
+        public static FloatBuffer allocateFloatBuffer(int count) {
+            return ByteBuffer.allocateDirect(count * Float.BYTES)
+                .order(ByteOrder.nativeOrder()).asFloatBuffer();
+        }
+
+        /**
+         * Allocate a direct int buffer in native byte order, usable in a MeshView.
+         *
+         * @param count number of ints
+         * @return the allocated buffer
+         */
+        public static IntBuffer allocateIntBuffer(int count) {
+            return ByteBuffer.allocateDirect(count * Integer.BYTES)
+                .order(ByteOrder.nativeOrder()).asIntBuffer();
+        }
+    }
 }
@@ -0,0 +1,87 @@
+import app.f3d.F3D.*;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+import java.nio.IntBuffer;
+
+public class TestSceneMeshView {
+
+  // On Windows, try to load opengl32 from Java path
+  // It's only useful in order to force Mesa software OpenGL
+  static {
+    if (System.getProperty("os.name").startsWith("Windows"))
+    {
+      try {
+        System.loadLibrary("opengl32");
+      } catch (UnsatisfiedLinkError e) {
+        // Ignore if opengl32 is not available
+      }
+    }
+  }
+
+  public static void main(String[] args) {
+    Engine engine = Engine.create(true);
+    Scene scene = engine.getScene();
+    Window window = engine.getWindow().setSize(300, 300);
+    Image emptyImage = window.renderToImage();
+
+    FloatBuffer points = Types.MeshView.allocateFloatBuffer(9);
+    points.put(new float[] { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f });
+    IntBuffer faceOffsets = Types.MeshView.allocateIntBuffer(2);
+    faceOffsets.put(new int[] { 0, 3 });
+    IntBuffer faceIndices = Types.MeshView.allocateIntBuffer(3);
+    faceIndices.put(new int[] { 0, 1, 2 });
+
+    Types.MeshView meshView = new Types.MeshView(points, null, null, faceOffsets, faceIndices);
+    meshView.name = "triangle";
+    scene.add(meshView);
+
+    // The buffers are used without any copy, collapsing the points after the mesh view is added
+    // leaves nothing to display
+    for (int i = 0; i < points.capacity(); i++) {
+      points.put(i, 0.0f);
+    }
+    assert window.renderToImage().equals(emptyImage) : "Mesh view buffers should not be copied";
+
+    // Heap buffers cannot be used without a copy and must be rejected
+    Types.MeshView heapMeshView = new Types.MeshView(
+      FloatBuffer.wrap(new float[] { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f }),
+      null, null, faceOffsets, faceIndices);
+
+    boolean rejected = false;
+    try {
+      scene.add(heapMeshView);
+    } catch (IllegalArgumentException e) {
+      rejected = true;
+    }
+    assert rejected : "Heap buffers should be rejected by a mesh view";
+
+    // Buffers not in native byte order cannot be read without a copy and must be rejected
+    ByteOrder otherOrder = ByteOrder.nativeOrder() == ByteOrder.LITTLE_ENDIAN
+      ? ByteOrder.BIG_ENDIAN : ByteOrder.LITTLE_ENDIAN;
+    FloatBuffer swappedPoints = ByteBuffer.allocateDirect(9 * Float.BYTES)
+      .order(otherOrder).asFloatBuffer();
+    Types.MeshView swappedMeshView =
+      new Types.MeshView(swappedPoints, null, null, faceOffsets, faceIndices);
+
+    rejected = false;
+    try {
+      scene.add(swappedMeshView);
+    } catch (IllegalArgumentException e) {
+      rejected = true;
+    }
+    assert rejected : "Buffers not in native byte order should be rejected by a mesh view";
+
+    // An invalid mesh view, without points, is reported as a load failure
+    boolean failed = false;
+    try {
+      scene.add(new Types.MeshView());
+    } catch (RuntimeException e) {
+      failed = true;
+    }
+    assert failed : "A mesh view without points should fail to load";
+
+    engine.close();
+  }
+}
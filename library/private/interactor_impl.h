@@ -80,7 +80,8 @@ public:
   interactor& setEventLoopUserCallback(
     std::function<void(interactor_state_t)> userCallback) override;
 
-  bool playInteraction(const std::filesystem::path& file, double deltaTime) override;
+  bool playInteraction(
+    const std::filesystem::path& file, double deltaTime, bool checkpointsOnly) override;
   bool recordInteraction(const std::filesystem::path& file) override;
 
   interactor& triggerNotification(
@@ -37,6 +37,7 @@ public:
   scene& add(const mesh_t& mesh) override;
   scene& add(std::shared_ptr<mesh_view> mesh) override;
   scene& add(const std::byte* buffer, std::size_t size) override;
+  scene& reload(const std::filesystem::path& filePath) override;
   scene& clear() override;
   int addLight(const light_state_t& lightState) const override;
   int getLightCount() const override;
@@ -51,6 +52,7 @@ public:
   unsigned int availableAnimations() const override;
   std::string getAnimationName(int index = -1) override;
   std::vector<std::string> getAnimationNames() override;
+  std::vector<file_memory_usage_t> getMemoryUsage() const override;
   ///@}
 
   /**
@@ -59,6 +61,21 @@ public:
    */
   void SetInteractor(interactor_impl* interactor);
 
+  /**
+   * Implementation only API.
+   * Pick up the newest state of each streamed mesh and update the scene accordingly.
+   * Return true if the scene was updated and needs to be rendered.
+   */
+  bool UpdateStreams();
+
+  /**
+   * Implementation only API.
+   * Check the memory used by the files against the memory budget again once the visibility of
+   * the auxiliary actors is known, ie: after loading and when the model options changed.
+   * Should be called before rendering.
+   */
+  void CheckMemoryBudget();
+
   /**
    * Display available cameras in the log
    */
@@ -28,6 +28,8 @@ class options;
 
 namespace detail
 {
+class scene_impl;
+
 class window_impl : public window
 {
 public:
@@ -59,6 +61,7 @@ public:
   window& setWindowName(std::string_view windowName) override;
   point3_t getWorldFromDisplay(const point3_t& displayPoint) const override;
   point3_t getDisplayFromWorld(const point3_t& worldPoint) const override;
+  std::vector<std::pair<std::string, double>> getFrameTimings() const override;
   ///@}
 
   /**
@@ -82,7 +85,8 @@ public:
   /**
    * Implementation only API.
    * Use all the rendering related options to update the configuration of the window
-   * and the rendering stack below.
+   * and the rendering stack below. Only the groups of options that changed since
+   * the last call are applied.
    * This is called automatically when calling scene::add and window::render but can also be called
    * manually when needed. Return true on success, false otherwise.
    */
@@ -125,6 +129,18 @@ public:
    */
   void SetInteractor(interactor_impl* interactor);
 
+  /**
+   * Implementation only API.
+   * Set the scene whose streamed meshes are updated before each render.
+   */
+  void SetScene(scene_impl* scene);
+
+  /**
+   * Implementation only API.
+   * Reapply the UI options on next render, used when the interactor bindings change.
+   */
+  void InvalidateUIOptions();
+
   /**
    * Trigger a render only of the UI
    * Does nothing if F3D_MODULE_UI is OFF
@@ -138,6 +154,20 @@ public:
   [[nodiscard]] vtkF3DRenderer* GetRenderer() const;
 
 private:
+  /**
+   * Update dynamic options and reset the camera if needed, before rendering.
+   */
+  void PrepareRender();
+
+  ///@{
+  /**
+   * Apply a group of options to the renderer, see UpdateDynamicOptions.
+   */
+  void UpdateModelOptions();
+  void UpdateRenderOptions();
+  void UpdateUIOptions();
+  ///@}
+
   class internals;
   std::unique_ptr<internals> Internals;
 };
@@ -200,7 +200,7 @@ public:
 
   /**
    * Set the cache path. The provided path is used as is.
-   * Currently, it's only used to store HDRI baked textures.
+   * It's used to store HDRI baked textures and linked shader program binaries.
    * By default, the cache path is:
    * - Windows: %LOCALAPPDATA%\f3d
    * - Linux: ~/.cache/f3d
@@ -300,6 +300,21 @@ public:
    */
   static void setReaderOption(const std::string& name, const std::string& value);
 
+  /**
+   * Start or stop recording a trace of the time spent in the stages of loading and rendering,
+   * eg: creating the importers, reading the files, setting up each actor, computing the
+   * coloring ranges and the bounds, compiling the shaders or rendering.
+   * Starting a recording removes any previously recorded trace.
+   * The trace is shared by all engines and is not recorded by default.
+   */
+  static void setTracing(bool enable);
+
+  /**
+   * Get the trace recorded since tracing was started, in the Chrome trace event JSON format,
+   * which can be opened with https://ui.perfetto.dev or chrome://tracing.
+   */
+  [[nodiscard]] static std::string getTrace();
+
   /**
    * A structure providing information about the libf3d.
    * Returned by getLibInfo().
@@ -144,9 +144,21 @@ public:
    *  - 0.1: Small visible difference.
    *  - 0.5: Comparable images.
    *  - 1.0: Different type, size or number of components
+   * Bitwise identical images are detected upfront and return 0 without computing the SSIM.
    */
   double compare(const image& reference) const;
 
+  /**
+   * Compare current image to a reference, tile by tile, for diagnostics.
+   * The images are split in tiles of tileSize x tileSize pixels, cropped on the last row and
+   * column, and the error of each tile is computed as in compare().
+   * Errors are returned in row-major order, starting with the first pixel of the buffer.
+   * Bitwise identical tiles have an error of 0.
+   * If the images cannot be compared or tileSize is 0, a single error of 1.0 is returned.
+   */
+  [[nodiscard]] std::vector<double> compareTiles(
+    const image& reference, unsigned int tileSize = 64) const;
+
   /**
    * Save an image to the provided file path, used as is, in the specified format.
    * Default format is PNG if not specified.
@@ -389,15 +389,21 @@ public:
     std::string desc, std::string value = "", double duration = 3.f) = 0;
 
   /**
-   * Play a VTK interaction file.
+   * Play a VTK interaction file or a binary interaction file.
    * Provided file path is used as is and file existence will be checked.
    * If the event loop is not already running, it will be triggered every deltaTime in seconds.
+   * If checkpointsOnly is true, events are played as fast as possible and only the render
+   * events of the interaction file trigger a render, then the final state is rendered once.
+   * This is much faster but not suited to interactions relying on rendered frames,
+   * eg: the console or the scene hierarchy.
    */
-  virtual bool playInteraction(const std::filesystem::path& file, double deltaTime = 1.0 / 30) = 0;
+  virtual bool playInteraction(const std::filesystem::path& file, double deltaTime = 1.0 / 30,
+    bool checkpointsOnly = false) = 0;
 
   /**
    * Start interaction and record it all in a VTK interaction file.
    * Provided file path will be used as is and the parent directories of the file will be created.
+   * If the file extension is `.f3drec`, a compact binary format is used instead.
    */
   virtual bool recordInteraction(const std::filesystem::path& file) = 0;
 
@@ -410,6 +416,8 @@ public:
   /**
    * Start the interactor event loop.
    * The event loop will be triggered every deltaTime in seconds.
+   * It only renders when a render was requested, an input was received
+   * or the UI is animated, eg: while notifications are displayed.
    * deltaTime should be strictly positive.
    * Safe to call multiple times but will log an info in that case.
    */
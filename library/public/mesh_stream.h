@@ -0,0 +1,94 @@
+#ifndef f3d_mesh_stream_h
+#define f3d_mesh_stream_h
+
+#include "export.h"
+#include "mesh_view.h"
+
+/// @cond
+#include <cstddef>
+/// @endcond
+
+namespace f3d
+{
+/**
+ * @class   mesh_stream
+ * @brief   A mesh_view continuously fed by a simulation
+ *
+ * The mesh_stream class is a mesh_view whose memory views are pushed by the application,
+ * typically from a simulation thread, instead of being pulled at given animation times.
+ * It relies on a triple buffer synchronized by a single atomic: the producer fills one of the
+ * `BUFFER_COUNT` buffers it owns, given by `getWriteBufferIndex`, then publishes a memory view
+ * pointing to it. The scene picks up the newest published state on each interactor event loop
+ * tick and before each render. The producer never waits for the rendering and the rendering
+ * never waits for the producer, intermediate states published between two picks are skipped.
+ *
+ * Memory of arrays that are not time dependent must remain valid and constant while the mesh is
+ * used in the scene, it can be shared between the buffers.
+ *
+ * Example usage:
+ *
+ * ```cpp
+ * auto stream = std::make_shared<f3d::mesh_stream>();
+ * scene.add(stream); // after a first publish
+ *
+ * // simulation thread
+ * size_t index = stream->getWriteBufferIndex();
+ * solver.step(buffers[index]);
+ * stream->publish(makeView(buffers[index]));
+ * ```
+ */
+class F3D_EXPORT mesh_stream : public mesh_view
+{
+public:
+  /**
+   * Number of buffers the producer must allocate for its time dependent memory
+   */
+  static constexpr size_t BUFFER_COUNT = 3;
+
+  /**
+   * Producer side: get the index, between 0 and BUFFER_COUNT - 1, of the buffer to fill with
+   * the next state. The memory of this buffer is not used by the scene until it is published.
+   */
+  [[nodiscard]] size_t getWriteBufferIndex() const;
+
+  /**
+   * Producer side: publish a view of the state written in the write buffer, never waits for the
+   * consumer. The view is copied into storage reused between publishes, so memory is only
+   * allocated while the number of scalars or the length of the names grows.
+   * The write buffer index changes after this call.
+   */
+  void publish(const memory_view_t& view);
+
+  /**
+   * Consumer side: pick up the newest published state, if any, never blocks.
+   * Return true if a new state has been picked up.
+   * This is called by the scene on each interactor event loop tick and before each render.
+   */
+  bool acquire();
+
+  /**
+   * Get the name of the mesh
+   */
+  [[nodiscard]] std::string getName() const override;
+
+  /**
+   * Get the view of the last picked up state, time is ignored.
+   */
+  [[nodiscard]] memory_view_t getMemoryView(double time) const override;
+
+  //! @cond
+  explicit mesh_stream(const std::string& name = "");
+  ~mesh_stream() override;
+  mesh_stream(const mesh_stream&) = delete;
+  mesh_stream(mesh_stream&&) = delete;
+  mesh_stream& operator=(const mesh_stream&) = delete;
+  mesh_stream& operator=(mesh_stream&&) = delete;
+  //! @endcond
+
+private:
+  class internals;
+  internals* Internals;
+};
+}
+
+#endif
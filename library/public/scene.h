@@ -101,6 +101,16 @@ public:
   }
   ///@}
 
+  /**
+   * Reload a file previously added to the scene, eg: after it has been modified on disk.
+   * Only this file is imported again, the other added files, the camera and the coloring
+   * are kept as is.
+   * If the file was not added to the scene or does not exist anymore,
+   * throw a load_failure_exception without changing the scene.
+   * If it fails to load the file, it clears the scene and throw a load_failure_exception.
+   */
+  virtual scene& reload(const std::filesystem::path& filePath) = 0;
+
   /**
    * Clear the scene of all added files
    */
@@ -206,6 +216,15 @@ public:
    */
   [[nodiscard]] virtual std::vector<std::string> getAnimationNames() = 0;
 
+  /**
+   * Return the memory used by each file added to the scene and by each of their actors.
+   * Arrays shared by multiple actors of a file are only accounted for the first one.
+   * GPU memory is estimated from the data to upload, as the actual buffers depend on
+   * the rendering options and the graphics driver.
+   * Returns an empty vector if no file has been added.
+   */
+  [[nodiscard]] virtual std::vector<file_memory_usage_t> getMemoryUsage() const = 0;
+
 protected:
   //! @cond
   scene() = default;
@@ -362,6 +362,39 @@ struct F3D_EXPORT light_state_t
   }
 };
 
+/**
+ * Describe the memory used by a file added to the scene or by one of its actors, in bytes.
+ * - host: points, cells and attribute arrays in CPU memory
+ * - geometry: estimated vertex and index buffers in GPU memory
+ * - textures: images of the textures, in CPU memory and uploaded to the GPU
+ * - auxiliary: estimated GPU memory of the visible normal glyphs, point sprites and volume
+ */
+struct memory_usage_t
+{
+  std::uint64_t host = 0;
+  std::uint64_t geometry = 0;
+  std::uint64_t textures = 0;
+  std::uint64_t auxiliary = 0;
+
+  /**
+   * Sum of all memory usages, textures are only counted once
+   */
+  [[nodiscard]] std::uint64_t total() const
+  {
+    return this->host + this->geometry + this->textures + this->auxiliary;
+  }
+};
+
+/**
+ * Describe the memory used by a file added to the scene, in total and for each of its actors.
+ */
+struct file_memory_usage_t
+{
+  std::string name;
+  memory_usage_t usage;
+  std::vector<memory_usage_t> actors;
+};
+
 }
 
 #endif
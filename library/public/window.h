@@ -7,6 +7,8 @@
 
 /// @cond
 #include <string>
+#include <utility>
+#include <vector>
 /// @endcond
 
 namespace f3d
@@ -119,6 +121,15 @@ public:
    */
   [[nodiscard]] virtual point3_t getDisplayFromWorld(const point3_t& worldPoint) const = 0;
 
+  /**
+   * Get the GPU time in seconds of the stages of the profiled frame read back during the latest
+   * render, in the order the stages were started, eg: `frame`, `frame/main`, `frame/ui`.
+   * Frames are only profiled when `ui.fps` is enabled and the timings are read back
+   * a few frames after being rendered, the result is empty when the latest render did not
+   * read back any timings or if the rendering backend does not support GPU timings.
+   */
+  [[nodiscard]] virtual std::vector<std::pair<std::string, double>> getFrameTimings() const = 0;
+
 protected:
   //! @cond
   window() = default;
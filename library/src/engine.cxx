@@ -9,6 +9,7 @@
 #include "utils.h"
 #include "window_impl.h"
 
+#include "F3DTrace.h"
 #include "vtkF3DNoRenderWindow.h"
 
 #include <vtkVersion.h>
@@ -445,6 +446,18 @@ void engine::setReaderOption(const std::string& name, const std::string& value)
   }
 }
 
+//----------------------------------------------------------------------------
+void engine::setTracing(bool enable)
+{
+  F3DTrace::SetEnabled(enable);
+}
+
+//----------------------------------------------------------------------------
+std::string engine::getTrace()
+{
+  return F3DTrace::GetChromeTrace();
+}
+
 //----------------------------------------------------------------------------
 engine::libInformation engine::getLibInfo()
 {
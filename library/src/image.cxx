@@ -15,6 +15,7 @@
 #include <vtkPNGReader.h>
 #include <vtkPNGWriter.h>
 #include <vtkPointData.h>
+#include <vtkSMPTools.h>
 #include <vtkSmartPointer.h>
 #include <vtkStringArray.h>
 #include <vtkTIFFWriter.h>
@@ -141,6 +142,66 @@ public:
         break;
     }
   }
+
+  static bool IsComparable(const image& self, const image& reference)
+  {
+    return self.getChannelType() == reference.getChannelType() &&
+      self.getChannelCount() == reference.getChannelCount() &&
+      self.getWidth() == reference.getWidth() && self.getHeight() == reference.getHeight();
+  }
+
+  /**
+   * Check if the [x0, x1[ x [y0, y1[ pixels of two comparable images are bitwise identical
+   */
+  static bool IsEqualRegion(const image& self, const image& reference, unsigned int x0,
+    unsigned int y0, unsigned int x1, unsigned int y1)
+  {
+    const size_t pixelSize =
+      static_cast<size_t>(self.getChannelCount()) * self.getChannelTypeSize();
+    const size_t rowSize = static_cast<size_t>(self.getWidth()) * pixelSize;
+    const uint8_t* selfBuffer = static_cast<const uint8_t*>(self.getContent());
+    const uint8_t* refBuffer = static_cast<const uint8_t*>(reference.getContent());
+    for (unsigned int y = y0; y < y1; y++)
+    {
+      const size_t offset = y * rowSize + x0 * pixelSize;
+      if (!std::equal(selfBuffer + offset, selfBuffer + offset + (x1 - x0) * pixelSize,
+            refBuffer + offset))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static vtkSmartPointer<vtkDoubleArray> ComputeSSIM(const image& self, const image& reference)
+  {
+    vtkNew<vtkImageSSIM> ssim;
+    std::vector<int> ranges(self.getChannelCount());
+    switch (self.getChannelType())
+    {
+      case ChannelType::BYTE:
+        std::ranges::fill(ranges, 256);
+        ssim->SetInputRange(ranges);
+        break;
+      case ChannelType::SHORT:
+        std::ranges::fill(ranges, 65535);
+        ssim->SetInputRange(ranges);
+        break;
+      case ChannelType::FLOAT:
+        ssim->SetInputToAuto();
+        break;
+    }
+
+    ssim->SetInputData(self.Internals->Image);
+    ssim->SetInputData(1, reference.Internals->Image);
+    ssim->Update();
+    vtkDoubleArray* scalars = vtkArrayDownCast<vtkDoubleArray>(
+      vtkDataSet::SafeDownCast(ssim->GetOutputDataObject(0))->GetPointData()->GetScalars());
+
+    // Images are checked to be comparable before, so this is always true
+    assert(scalars != nullptr);
+    return scalars;
+  }
 };
 
 //----------------------------------------------------------------------------
@@ -344,57 +405,90 @@ void* image::getContent() const
 //----------------------------------------------------------------------------
 double image::compare(const image& reference) const
 {
-  ChannelType type = this->getChannelType();
-  if (type != reference.getChannelType())
+  if (!internals::IsComparable(*this, reference))
   {
     return 1.0;
   }
 
-  unsigned int count = this->getChannelCount();
-  if (count != reference.getChannelCount())
+  if (this->getWidth() == 0 && this->getHeight() == 0)
   {
-    return 1.0;
+    return 0.0;
   }
 
-  if (this->getWidth() != reference.getWidth() || this->getHeight() != reference.getHeight())
+  // Identical buffers are frequent when comparing against baselines, skip the SSIM entirely
+  if (internals::IsEqualRegion(*this, reference, 0, 0, this->getWidth(), this->getHeight()))
   {
-    return 1.0;
+    return 0.0;
   }
 
-  if (this->getWidth() == 0 && this->getHeight() == 0)
+  vtkSmartPointer<vtkDoubleArray> scalars = internals::ComputeSSIM(*this, reference);
+
+  double error, unused;
+  vtkImageSSIM::ComputeErrorMetrics(scalars, error, unused);
+  return error;
+}
+
+//----------------------------------------------------------------------------
+std::vector<double> image::compareTiles(const image& reference, unsigned int tileSize) const
+{
+  if (!internals::IsComparable(*this, reference) || tileSize == 0)
   {
-    return 0.0;
+    return { 1.0 };
   }
 
-  vtkNew<vtkImageSSIM> ssim;
-  std::vector<int> ranges(count);
-  switch (type)
+  const unsigned int width = this->getWidth();
+  const unsigned int height = this->getHeight();
+  const unsigned int tilesX = (width + tileSize - 1) / tileSize;
+  const unsigned int tilesY = (height + tileSize - 1) / tileSize;
+  std::vector<double> errors(static_cast<size_t>(tilesX) * tilesY, 0.0);
+  if (errors.empty())
   {
-    case ChannelType::BYTE:
-      std::ranges::fill(ranges, 256);
-      ssim->SetInputRange(ranges);
-      break;
-    case ChannelType::SHORT:
-      std::ranges::fill(ranges, 65535);
-      ssim->SetInputRange(ranges);
-      break;
-    case ChannelType::FLOAT:
-      ssim->SetInputToAuto();
-      break;
+    return errors;
+  }
+
+  // The SSIM map is computed once, only the reduction is done per tile, when the tile differs
+  vtkSmartPointer<vtkDoubleArray> scalars;
+  if (!internals::IsEqualRegion(*this, reference, 0, 0, width, height))
+  {
+    scalars = internals::ComputeSSIM(*this, reference);
   }
 
-  ssim->SetInputData(this->Internals->Image);
-  ssim->SetInputData(1, reference.Internals->Image);
-  ssim->Update();
-  vtkDoubleArray* scalars = vtkArrayDownCast<vtkDoubleArray>(
-    vtkDataSet::SafeDownCast(ssim->GetOutputDataObject(0))->GetPointData()->GetScalars());
+  if (scalars)
+  {
+    const int nComp = scalars->GetNumberOfComponents();
+    vtkSMPTools::For(0, static_cast<vtkIdType>(errors.size()),
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        vtkNew<vtkDoubleArray> tileScalars;
+        tileScalars->SetNumberOfComponents(nComp);
+        for (vtkIdType tile = begin; tile < end; tile++)
+        {
+          const unsigned int x0 = static_cast<unsigned int>(tile % tilesX) * tileSize;
+          const unsigned int y0 = static_cast<unsigned int>(tile / tilesX) * tileSize;
+          const unsigned int x1 = std::min(x0 + tileSize, width);
+          const unsigned int y1 = std::min(y0 + tileSize, height);
+          if (internals::IsEqualRegion(*this, reference, x0, y0, x1, y1))
+          {
+            continue;
+          }
 
-  // Thanks to the checks above, this is always true
-  assert(scalars != nullptr);
+          tileScalars->SetNumberOfTuples(static_cast<vtkIdType>(x1 - x0) * (y1 - y0));
+          vtkIdType tupleIdx = 0;
+          for (unsigned int y = y0; y < y1; y++)
+          {
+            const double* row =
+              scalars->GetPointer((static_cast<vtkIdType>(y) * width + x0) * nComp);
+            std::copy_n(row, (x1 - x0) * nComp, tileScalars->GetPointer(tupleIdx * nComp));
+            tupleIdx += x1 - x0;
+          }
 
-  double error, unused;
-  vtkImageSSIM::ComputeErrorMetrics(scalars, error, unused);
-  return error;
+          double unused;
+          vtkImageSSIM::ComputeErrorMetrics(tileScalars, errors[tile], unused);
+        }
+      });
+  }
+
+  return errors;
 }
 
 //----------------------------------------------------------------------------
@@ -7,6 +7,7 @@
 #include "utils.h"
 #include "window_impl.h"
 
+#include "vtkF3DCellPicker.h"
 #include "vtkF3DConsoleOutputWindow.h"
 
 #if F3D_MODULE_UI
@@ -15,19 +16,18 @@
 
 #include "vtkF3DInteractorEventRecorder.h"
 #include "vtkF3DInteractorStyle.h"
+#include "vtkF3DPointPicker.h"
 #include "vtkF3DRenderer.h"
 #include "vtkF3DUIActor.h"
 #include "vtkF3DUIObserver.h"
 #include "vtkF3DUserEvents.h"
 
 #include <vtkCallbackCommand.h>
-#include <vtkCellPicker.h>
 #include <vtkGenericRenderWindowInteractor.h>
 #include <vtkMath.h>
 #include <vtkMatrix3x3.h>
 #include <vtkNew.h>
 #include <vtkPicker.h>
-#include <vtkPointPicker.h>
 #include <vtkRenderWindow.h>
 #include <vtkRenderWindowInteractor.h>
 #include <vtkRendererCollection.h>
@@ -100,6 +100,12 @@ public:
 
     this->UIObserver->InstallObservers(this->VTKInteractor);
 
+    // Any input can change the UI, observe before the UI observer as it can abort events
+    vtkNew<vtkCallbackCommand> inputCallback;
+    inputCallback->SetClientData(this);
+    inputCallback->SetCallback(OnInputEvent);
+    this->VTKInteractor->AddObserver(vtkCommand::AnyEvent, inputCallback, 3.f);
+
     // observe UI event to trigger commands
     vtkNew<vtkCallbackCommand> commandCallback;
     commandCallback->SetClientData(this);
@@ -321,6 +327,16 @@ public:
     self->RenderRequested = true;
   }
 
+  //----------------------------------------------------------------------------
+  static void OnInputEvent(vtkObject*, unsigned long event, void* clientData, void*)
+  {
+    if (event != vtkCommand::TimerEvent)
+    {
+      internals* self = static_cast<internals*>(clientData);
+      self->UIRenderRequested = true;
+    }
+  }
+
   //----------------------------------------------------------------------------
   static void OnKeyPress(vtkObject*, unsigned long, void* clientData, void*)
   {
@@ -643,24 +659,45 @@ public:
     this->AnimationManager->SetDeltaTime(deltaTime);
     this->AnimationManager->Tick();
 
+    // Pick up the newest states of streamed meshes, never waiting for their producer
+    if (this->Scene.UpdateStreams())
+    {
+      this->RenderRequested = true;
+    }
+
     vtkRenderWindow* renWin = this->Window.GetRenderWindow();
     vtkF3DRenderer* ren = vtkF3DRenderer::SafeDownCast(renWin->GetRenderers()->GetFirstRenderer());
-    ren->SetUIDeltaTime(deltaTime);
     ren->SetTotalTime(ren->GetTotalTime() + deltaTime);
 
-    // Determine if we need a full render or just a UI render
-    // At the moment, only TAA requires a full render each frame
-    bool forceRender = this->Options.render.effect.antialiasing.mode == "taa";
+    // The UI delta time covers the ticks skipped while idle
+    this->UIDeltaTime += deltaTime;
+
+    // When playing an interaction checkpoints only, renders are deferred to the checkpoints
+    if (this->PlayingCheckpointsOnly)
+    {
+      return;
+    }
+
+    // Determine if we need a full render, a UI render or no render at all
+    // At the moment, only TAA requires a full render each frame, until its image is stable
+    bool forceRender = !ren->IsRenderConverged();
 
     if (this->RenderRequested || forceRender)
     {
+      ren->SetUIDeltaTime(this->UIDeltaTime);
+      this->UIDeltaTime = 0;
       this->Window.render();
       this->RenderRequested = false;
+      this->UIRenderRequested = false;
     }
-    else
+    else if (this->UIRenderRequested || ren->IsUIAnimated())
     {
+      ren->SetUIDeltaTime(this->UIDeltaTime);
+      this->UIDeltaTime = 0;
+      this->UIRenderRequested = false;
       this->Window.RenderUIOnly();
     }
+    // Otherwise, nothing changed since last tick, stay idle until an input is received
   }
 
   //----------------------------------------------------------------------------
@@ -684,8 +721,8 @@ public:
 
   std::map<std::string, std::string> AliasMap;
 
-  vtkNew<vtkCellPicker> CellPicker;
-  vtkNew<vtkPointPicker> PointPicker;
+  vtkNew<vtkF3DCellPicker> CellPicker;
+  vtkNew<vtkF3DPointPicker> PointPicker;
 
   int MiddleButtonDownPosition[2] = { 0, 0 };
 
@@ -696,6 +733,9 @@ public:
   unsigned long EventLoopTimerId = 0;
   int EventLoopObserverId = -1;
   std::atomic<bool> RenderRequested = false;
+  bool PlayingCheckpointsOnly = false;
+  bool UIRenderRequested = true;
+  double UIDeltaTime = 0;
   std::atomic<bool> StopRequested = false;
 
   double CallbackDeltaTime = 1.0 / 30; /* Default DeltaTime (30fps) */
@@ -1568,6 +1608,8 @@ bool interactor_impl::triggerCommand(std::string_view command, bool keepComments
 //----------------------------------------------------------------------------
 interactor& interactor_impl::initBindings()
 {
+  // Drop zone binds shown by the UI are recovered from the bindings
+  this->Internals->Window.InvalidateUIOptions();
   this->Internals->Bindings.clear();
   this->Internals->GroupedBinds.clear();
   this->Internals->OrderedBindGroups.clear();
@@ -1753,6 +1795,7 @@ interactor& interactor_impl::addBinding(const interaction_bind_t& bind,
       // Add the group in order if first addition
       this->Internals->OrderedBindGroups.emplace_back(groupIt->first);
     }
+    this->Internals->Window.InvalidateUIOptions();
   }
   return *this;
 }
@@ -1769,6 +1812,7 @@ interactor& interactor_impl::addBinding(const interaction_bind_t& bind, std::str
 interactor& interactor_impl::removeBinding(const interaction_bind_t& bind)
 {
   this->Internals->Bindings.erase(bind);
+  this->Internals->Window.InvalidateUIOptions();
 
   // Look for the group of the removed bind
   auto it = std::ranges::find_if(
@@ -2030,7 +2074,7 @@ interactor& interactor_impl::setEventLoopUserCallback(
 }
 
 //----------------------------------------------------------------------------
-bool interactor_impl::playInteraction(const fs::path& file, double loopTime)
+bool interactor_impl::playInteraction(const fs::path& file, double loopTime, bool checkpointsOnly)
 {
   try
   {
@@ -2046,7 +2090,18 @@ bool interactor_impl::playInteraction(const fs::path& file, double loopTime)
 
     bool loop = this->Internals->StartEventLoop(loopTime);
     this->Internals->Recorder->SetFileName(file.string().c_str());
+    this->Internals->Recorder->SetCheckpointsOnly(checkpointsOnly);
+    this->Internals->PlayingCheckpointsOnly = checkpointsOnly;
     this->Internals->Recorder->Play();
+    this->Internals->PlayingCheckpointsOnly = false;
+    this->Internals->Recorder->SetCheckpointsOnly(false);
+
+    // Renders were skipped while playing, render the final state
+    if (checkpointsOnly && !this->Internals->VTKInteractor->GetDone())
+    {
+      this->Internals->Window.render();
+      this->Internals->RenderRequested = false;
+    }
 
     if (loop)
     {
@@ -0,0 +1,88 @@
+#include "mesh_stream.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace f3d
+{
+class mesh_stream::internals
+{
+public:
+  // The middle buffer index is shared between the producer and the consumer,
+  // along with a flag set when it contains a state not picked up yet
+  static constexpr uint8_t INDEX_MASK = 0x3;
+  static constexpr uint8_t FRESH_FLAG = 0x4;
+
+  std::string Name;
+  std::array<memory_view_t, BUFFER_COUNT> Views;
+
+  std::atomic<uint8_t> Middle = 1;
+
+  // Only accessed by the producer
+  uint8_t Back = 2;
+
+  // Only accessed by the consumer
+  uint8_t Front = 0;
+};
+
+//----------------------------------------------------------------------------
+mesh_stream::mesh_stream(const std::string& name)
+  : Internals(new mesh_stream::internals())
+{
+  this->Internals->Name = name;
+}
+
+//----------------------------------------------------------------------------
+mesh_stream::~mesh_stream()
+{
+  delete this->Internals;
+}
+
+//----------------------------------------------------------------------------
+size_t mesh_stream::getWriteBufferIndex() const
+{
+  return this->Internals->Back;
+}
+
+//----------------------------------------------------------------------------
+void mesh_stream::publish(const memory_view_t& view)
+{
+  // Each buffer keeps its view between publishes, the copy assignment reuses the capacity of its
+  // scalars vectors and names, so memory is only allocated when they grow
+  this->Internals->Views[this->Internals->Back] = view;
+
+  // Swap the back and middle buffers, the previous middle buffer becomes writable,
+  // either it has been picked up or it is skipped
+  uint8_t previous = this->Internals->Middle.exchange(
+    this->Internals->Back | internals::FRESH_FLAG, std::memory_order_acq_rel);
+  this->Internals->Back = previous & internals::INDEX_MASK;
+}
+
+//----------------------------------------------------------------------------
+bool mesh_stream::acquire()
+{
+  if ((this->Internals->Middle.load(std::memory_order_acquire) & internals::FRESH_FLAG) == 0)
+  {
+    return false;
+  }
+
+  // Swap the front and middle buffers, the middle buffer may have been published again since
+  uint8_t previous =
+    this->Internals->Middle.exchange(this->Internals->Front, std::memory_order_acq_rel);
+  this->Internals->Front = previous & internals::INDEX_MASK;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+std::string mesh_stream::getName() const
+{
+  return this->Internals->Name;
+}
+
+//----------------------------------------------------------------------------
+mesh_view::memory_view_t mesh_stream::getMemoryView(double) const
+{
+  return this->Internals->Views[this->Internals->Front];
+}
+}
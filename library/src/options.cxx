@@ -91,14 +91,7 @@ options& options::toggle(std::string_view name)
 //----------------------------------------------------------------------------
 bool options::isSame(const options& other, std::string_view name) const
 {
-  try
-  {
-    return options_generated::get(*this, name) == options_generated::get(other, name);
-  }
-  catch (const f3d::options::no_value_exception&)
-  {
-    return !this->hasValue(name) && !other.hasValue(name);
-  }
+  return options_generated::isSame(*this, other, name);
 }
 
 //----------------------------------------------------------------------------
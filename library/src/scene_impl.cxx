@@ -3,11 +3,13 @@
 #include "animationManager.h"
 #include "interactor_impl.h"
 #include "log.h"
+#include "mesh_stream.h"
 #include "options.h"
 #include "scene.h"
 #include "window_impl.h"
 
 #include "F3DStyle.h"
+#include "F3DTrace.h"
 #include "factory.h"
 #include "vtkF3DGenericImporter.h"
 #include "vtkF3DMemoryMesh.h"
@@ -32,12 +34,50 @@
 
 // requires https://gitlab.kitware.com/vtk/vtk/-/merge_requests/12411
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251110)
+#include <vtkAOSDataArrayTemplate.h>
 #include <vtkStridedArray.h>
 #endif
 
+#include <algorithm>
 #include <numeric>
 #include <vector>
 
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251110)
+namespace
+{
+/**
+ * Create an array pointing to mesh_view memory, without any copy.
+ * Tightly packed memory is wrapped in an AOS array, that the OpenGL mapper can upload with a
+ * direct copy, other layouts are wrapped in a strided array, accessed tuple per tuple.
+ */
+template<typename DataT>
+vtkSmartPointer<vtkDataArray> CreateArrayView(
+  const void* data, size_t stride, int components, size_t tupleCount, const char* name)
+{
+  vtkSmartPointer<vtkDataArray> array;
+  if (stride == static_cast<size_t>(components))
+  {
+    vtkNew<vtkAOSDataArrayTemplate<DataT>> aosArray;
+    aosArray->SetNumberOfComponents(components);
+    // The memory is owned by the mesh_view, never free it and only read from it
+    aosArray->SetArray(const_cast<DataT*>(reinterpret_cast<const DataT*>(data)),
+      static_cast<vtkIdType>(tupleCount * components), 1);
+    array = aosArray;
+  }
+  else
+  {
+    vtkNew<vtkStridedArray<DataT>> stridedArray;
+    stridedArray->SetNumberOfComponents(components);
+    stridedArray->SetNumberOfTuples(static_cast<vtkIdType>(tupleCount));
+    stridedArray->ConstructBackend(reinterpret_cast<const DataT*>(data), stride, components);
+    array = stridedArray;
+  }
+  array->SetName(name);
+  return array;
+}
+}
+#endif
+
 namespace fs = std::filesystem;
 
 namespace f3d::detail
@@ -102,8 +142,35 @@ public:
     data->timer->StartTimer();
   }
 
+  /**
+   * Enable the deferred array that will be needed for coloring before the first read,
+   * so that the reader does not have to read the file again once loaded.
+   * Without an array name, the first deferred array in name order is the most likely to be
+   * selected, the renderer loads another one if needed.
+   */
+  void EnableDeferredArrays(vtkF3DGenericImporter* importer)
+  {
+    const auto& model = this->Options.model;
+    if (model.scivis.enable || model.volume.enable)
+    {
+      std::optional<std::string> arrayName = model.scivis.array_name;
+      if (!arrayName.has_value())
+      {
+        std::vector<std::string> deferredNames = importer->GetDeferredArrayNames();
+        if (deferredNames.empty())
+        {
+          return;
+        }
+        arrayName = *std::min_element(deferredNames.begin(), deferredNames.end());
+      }
+      importer->LoadDeferredArrays(arrayName);
+    }
+  }
+
   void Load(const std::vector<std::pair<std::string, vtkSmartPointer<vtkImporter>>>& importers)
   {
+    F3DTrace::Scope trace("load", "load");
+
     for (const auto& importer : importers)
     {
       this->MetaImporter->AddImporter(importer);
@@ -143,30 +210,190 @@ public:
       progressWidget->Off();
 
       this->MetaImporter->Clear();
+      this->ImporterPaths.clear();
       this->Window.Initialize();
       throw scene::load_failure_exception("failed to load scene");
     }
 
+    // Importers not added from a file cannot be reloaded and have no path
+    this->ImporterPaths.resize(this->MetaImporter->GetImporterInfoCount());
+
     // Remove anything progress related if any
     this->MetaImporter->RemoveObservers(vtkCommand::ProgressEvent);
     progressWidget->Off();
 
     // Initialize the animation using temporal information from the importer
-    this->AnimationManager.UpdateDynamicOptions();
-    this->AnimationManager.Initialize();
+    {
+      F3DTrace::Scope animationTrace("initialize animation", "load");
+      this->AnimationManager.UpdateDynamicOptions();
+      this->AnimationManager.Initialize();
+    }
 
     // Update all window options and reset camera to bounds if needed
-    this->Window.UpdateDynamicOptions();
+    {
+      F3DTrace::Scope optionsTrace("update dynamic options", "load");
+      this->Window.UpdateDynamicOptions();
+    }
     if (!this->Options.scene.camera.index.has_value())
     {
+      F3DTrace::Scope cameraTrace("reset camera to bounds", "load");
       this->Window.getCamera().resetToBounds();
     }
 
     scene_impl::internals::DisplayAllInfo(this->MetaImporter, this->Window);
+    this->CheckMemoryBudget(true);
+    this->MemoryBudgetOptions.reset();
+  }
+
+  /**
+   * Replace the importer at the provided index and import it, keeping the other importers
+   * and the camera as is
+   */
+  void Reload(int index, const std::pair<std::string, vtkSmartPointer<vtkImporter>>& importer)
+  {
+    // Importing may set the camera, eg: when a camera index is provided
+    camera& cam = this->Window.getCamera();
+    camera_state_t cameraState = cam.getState();
+
+    this->MetaImporter->ReplaceImporter(index, importer);
+    if (!this->MetaImporter->Update())
+    {
+      this->MetaImporter->Clear();
+      this->ImporterPaths.clear();
+      this->Window.Initialize();
+      throw scene::load_failure_exception("failed to reload " + importer.first);
+    }
+    cam.setState(cameraState);
+
+    // The reloaded file may have different animations
+    this->AnimationManager.UpdateDynamicOptions();
+    this->AnimationManager.Initialize();
+
+    this->Window.UpdateDynamicOptions();
+    scene_impl::internals::DisplayAllInfo(this->MetaImporter, this->Window);
+    this->CheckMemoryBudget(true);
+    this->MemoryBudgetOptions.reset();
+  }
+
+  static memory_usage_t ToMemoryUsage(const vtkF3DMetaImporter::MemoryUsage& usage)
+  {
+    return { static_cast<std::uint64_t>(usage.HostBytes),
+      static_cast<std::uint64_t>(usage.GeometryBytes),
+      static_cast<std::uint64_t>(usage.TextureBytes),
+      static_cast<std::uint64_t>(usage.AuxiliaryBytes) };
+  }
+
+  /**
+   * Log a warning with the memory used by each file
+   * if the memory used by all files exceeds the memory budget, if any.
+   * Unless forced, nothing is logged when the memory used did not change since the last check.
+   */
+  void CheckMemoryBudget(bool force)
+  {
+    const std::optional<int>& budget = this->Options.scene.memory_budget;
+    if (!budget.has_value())
+    {
+      return;
+    }
+
+    std::vector<vtkF3DMetaImporter::ImporterMemoryUsage> usages =
+      this->MetaImporter->GetMemoryUsage();
+    vtkIdType totalBytes = 0;
+    for (const auto& importerUsage : usages)
+    {
+      totalBytes += importerUsage.Total.GetTotalBytes();
+    }
+
+    if (!force && totalBytes == this->CheckedMemoryBytes)
+    {
+      return;
+    }
+    this->CheckedMemoryBytes = totalBytes;
+
+    constexpr vtkIdType mebibyte = 1 << 20;
+    if (totalBytes <= static_cast<vtkIdType>(budget.value()) * mebibyte)
+    {
+      return;
+    }
+
+    log::warn("Memory used by the loaded files (", totalBytes / mebibyte,
+      " MiB) exceeds the memory budget (", budget.value(), " MiB):");
+    for (const auto& importerUsage : usages)
+    {
+      const vtkF3DMetaImporter::MemoryUsage& usage = importerUsage.Total;
+      log::warn("- ", importerUsage.Name, ": ", usage.GetTotalBytes() / mebibyte, " MiB (host ",
+        usage.HostBytes / mebibyte, ", geometry ", usage.GeometryBytes / mebibyte, ", textures ",
+        usage.TextureBytes / mebibyte, ", auxiliary ", usage.AuxiliaryBytes / mebibyte, ")");
+    }
+  }
+
+  /**
+   * Create the importer for the provided file path, using the generic importer
+   * if the reader does not provide a scene reader.
+   * Throw a load_failure_exception if the file does not exist or is not supported.
+   */
+  vtkSmartPointer<vtkImporter> CreateImporter(const fs::path& filePath)
+  {
+    // Only convert the path when recording
+    std::optional<F3DTrace::Scope> trace;
+    if (F3DTrace::IsEnabled())
+    {
+      trace.emplace("create importer", filePath.filename().string(), "load");
+    }
+
+    if (!vtksys::SystemTools::FileExists(filePath.string(), true))
+    {
+      throw scene::load_failure_exception(filePath.string() + " does not exists");
+    }
+    std::optional<std::string> forceReader = this->Options.scene.force_reader;
+    // Recover the importer for the provided file path
+    const f3d::reader* reader = f3d::factory::instance()->getReader(filePath.string(), forceReader);
+    if (reader)
+    {
+      if (forceReader)
+      {
+        log::debug("Forcing reader ", (*forceReader), " for ", filePath.string());
+      }
+      else
+      {
+        log::debug("Found a reader for \"", filePath.string(), "\" : \"", reader->getName(), "\"");
+      }
+    }
+    else
+    {
+      if (forceReader)
+      {
+        throw scene::load_failure_exception(*forceReader + " is not a valid force reader");
+      }
+      throw scene::load_failure_exception(filePath.string() +
+        " is not a file of a supported 3D scene file format, use force reader to force a specific "
+        "reader");
+    }
+
+    vtkSmartPointer<vtkImporter> importer = reader->createSceneReader(filePath.string());
+    if (!importer)
+    {
+      // XXX: F3D Plugin CMake logic ensure there is either a scene reader or a geometry reader
+      auto vtkReader = reader->createGeometryReader(filePath.string());
+      assert(vtkReader);
+      vtkSmartPointer<vtkF3DGenericImporter> genericImporter =
+        vtkSmartPointer<vtkF3DGenericImporter>::New();
+      genericImporter->SetInternalReader(vtkReader);
+      this->EnableDeferredArrays(genericImporter);
+      importer = genericImporter;
+    }
+    return importer;
   }
 
   static void DisplayImporterDescription(log::VerboseLevel level, vtkImporter* importer)
   {
+    // The description lists the ranges of all arrays, read the ones deferred by readers
+    vtkF3DMetaImporter* metaImporter = vtkF3DMetaImporter::SafeDownCast(importer);
+    if (metaImporter && level >= log::getVerboseLevel())
+    {
+      metaImporter->LoadDeferredArrays(std::nullopt);
+    }
+
     vtkIdType availCameras = importer->GetNumberOfCameras();
     if (availCameras <= 0)
     {
@@ -203,16 +430,31 @@ public:
   animationManager AnimationManager;
 
   vtkNew<vtkF3DMetaImporter> MetaImporter;
+
+  // Path of the file of each importer of the meta importer, empty if not added from a file
+  std::vector<fs::path> ImporterPaths;
+
+  // Streamed meshes and their source, checked for new states on each event loop tick
+  std::vector<std::pair<std::shared_ptr<mesh_stream>, vtkSmartPointer<vtkAlgorithm>>> Streams;
+
+  // Memory used by all files when last checked against the memory budget,
+  // and model options at that time, unset until rendered after loading
+  vtkIdType CheckedMemoryBytes = 0;
+  std::optional<options> MemoryBudgetOptions;
 };
 
 //----------------------------------------------------------------------------
 scene_impl::scene_impl(options& options, window_impl& window)
   : Internals(std::make_unique<scene_impl::internals>(options, window))
 {
+  window.SetScene(this);
 }
 
 //----------------------------------------------------------------------------
-scene_impl::~scene_impl() = default;
+scene_impl::~scene_impl()
+{
+  this->Internals->Window.SetScene(nullptr);
+}
 
 //----------------------------------------------------------------------------
 scene& scene_impl::add(const fs::path& filePath)
@@ -238,7 +480,10 @@ scene& scene_impl::add(const std::vector<fs::path>& filePaths)
     return *this;
   }
 
+  F3DTrace::Scope trace("scene::add", "load");
+
   std::vector<std::pair<std::string, vtkSmartPointer<vtkImporter>>> importers;
+  std::vector<fs::path> loadedPaths;
   for (const fs::path& filePath : filePaths)
   {
     if (filePath.empty())
@@ -247,47 +492,9 @@ scene& scene_impl::add(const std::vector<fs::path>& filePaths)
       continue;
     }
 
-    if (!vtksys::SystemTools::FileExists(filePath.string(), true))
-    {
-      throw scene::load_failure_exception(filePath.string() + " does not exists");
-    }
-    std::optional<std::string> forceReader = this->Internals->Options.scene.force_reader;
-    // Recover the importer for the provided file path
-    const f3d::reader* reader = f3d::factory::instance()->getReader(filePath.string(), forceReader);
-    if (reader)
-    {
-      if (forceReader)
-      {
-        log::debug("Forcing reader ", (*forceReader), " for ", filePath.string());
-      }
-      else
-      {
-        log::debug("Found a reader for \"", filePath.string(), "\" : \"", reader->getName(), "\"");
-      }
-    }
-    else
-    {
-      if (forceReader)
-      {
-        throw scene::load_failure_exception(*forceReader + " is not a valid force reader");
-      }
-      throw scene::load_failure_exception(filePath.string() +
-        " is not a file of a supported 3D scene file format, use force reader to force a specific "
-        "reader");
-    }
-
-    vtkSmartPointer<vtkImporter> importer = reader->createSceneReader(filePath.string());
-    if (!importer)
-    {
-      // XXX: F3D Plugin CMake logic ensure there is either a scene reader or a geometry reader
-      auto vtkReader = reader->createGeometryReader(filePath.string());
-      assert(vtkReader);
-      vtkSmartPointer<vtkF3DGenericImporter> genericImporter =
-        vtkSmartPointer<vtkF3DGenericImporter>::New();
-      genericImporter->SetInternalReader(vtkReader);
-      importer = genericImporter;
-    }
-    importers.emplace_back(filePath.filename().string(), importer);
+    importers.emplace_back(
+      filePath.filename().string(), this->Internals->CreateImporter(filePath));
+    loadedPaths.emplace_back(filePath);
   }
 
   log::debug("\nLoading files: ");
@@ -305,6 +512,30 @@ scene& scene_impl::add(const std::vector<fs::path>& filePaths)
   log::debug("");
 
   this->Internals->Load(importers);
+
+  // Record the path of the files just added, for them to be reloaded
+  std::copy(loadedPaths.begin(), loadedPaths.end(),
+    this->Internals->ImporterPaths.end() - static_cast<std::ptrdiff_t>(loadedPaths.size()));
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+scene& scene_impl::reload(const fs::path& filePath)
+{
+  const std::vector<fs::path>& paths = this->Internals->ImporterPaths;
+  auto it = std::find(paths.begin(), paths.end(), filePath);
+  if (filePath.empty() || it == paths.end())
+  {
+    throw scene::load_failure_exception(filePath.string() + " has not been added to the scene");
+  }
+
+  F3DTrace::Scope trace("scene::reload", "load");
+
+  vtkSmartPointer<vtkImporter> importer = this->Internals->CreateImporter(filePath);
+  log::debug("\nReloading file: ", filePath.string(), "\n");
+
+  this->Internals->Reload(
+    static_cast<int>(std::distance(paths.begin(), it)), { filePath.filename().string(), importer });
   return *this;
 }
 
@@ -365,6 +596,7 @@ scene& scene_impl::add(const std::byte* buffer, std::size_t size)
 
     vtkNew<vtkF3DGenericImporter> genericImporter;
     genericImporter->SetInternalReader(vtkReader);
+    this->Internals->EnableDeferredArrays(genericImporter);
     importer = genericImporter;
   }
 
@@ -459,8 +691,7 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251110)
   vtkNew<vtkF3DMemoryMesh> vtkSource;
 
-  // Only time range is supported at the moment but we should also add support
-  // for time steps and simulated meshes in the future
+  // Time steps are not supported yet, streamed meshes are updated by UpdateStreams
   auto timeRange = mesh->getTimeRange();
   vtkSource->SetTimeRange(timeRange[0], timeRange[1]);
 
@@ -502,15 +733,9 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
         f3d::mesh_view::dataTypeDispatch(memoryView.points.type,
           [&]<typename DataT>()
           {
-            vtkNew<vtkStridedArray<DataT>> positions;
-            positions->SetName(
-              memoryView.points.name.empty() ? "Positions" : memoryView.points.name.c_str());
-            positions->SetNumberOfComponents(3);
-            positions->SetNumberOfTuples(memoryView.pointCount);
-            positions->ConstructBackend(
-              reinterpret_cast<const DataT*>(memoryView.points.data), memoryView.points.stride, 3);
-
-            points->SetData(positions);
+            points->SetData(CreateArrayView<DataT>(memoryView.points.data,
+              memoryView.points.stride, 3, memoryView.pointCount,
+              memoryView.points.name.empty() ? "Positions" : memoryView.points.name.c_str()));
           });
 
         polydata->SetPoints(points);
@@ -534,15 +759,9 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
         f3d::mesh_view::dataTypeDispatch(memoryView.normals.type,
           [&]<typename DataT>()
           {
-            vtkNew<vtkStridedArray<DataT>> normals;
-            normals->SetName(
-              memoryView.normals.name.empty() ? "Normals" : memoryView.normals.name.c_str());
-            normals->SetNumberOfComponents(3);
-            normals->SetNumberOfTuples(memoryView.pointCount);
-            normals->ConstructBackend(reinterpret_cast<const DataT*>(memoryView.normals.data),
-              memoryView.normals.stride, 3);
-
-            polydata->GetPointData()->SetNormals(normals);
+            polydata->GetPointData()->SetNormals(CreateArrayView<DataT>(memoryView.normals.data,
+              memoryView.normals.stride, 3, memoryView.pointCount,
+              memoryView.normals.name.empty() ? "Normals" : memoryView.normals.name.c_str()));
           });
       }
 
@@ -566,17 +785,12 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
         f3d::mesh_view::dataTypeDispatch(memoryView.textureCoordinates.type,
           [&]<typename DataT>()
           {
-            vtkNew<vtkStridedArray<DataT>> tcoords;
-            tcoords->SetName(memoryView.textureCoordinates.name.empty()
-                ? "TCoords"
-                : memoryView.textureCoordinates.name.c_str());
-            tcoords->SetNumberOfComponents(2);
-            tcoords->SetNumberOfTuples(memoryView.pointCount);
-            tcoords->ConstructBackend(
-              reinterpret_cast<const DataT*>(memoryView.textureCoordinates.data),
-              memoryView.textureCoordinates.stride, 2);
-
-            polydata->GetPointData()->SetTCoords(tcoords);
+            polydata->GetPointData()->SetTCoords(
+              CreateArrayView<DataT>(memoryView.textureCoordinates.data,
+                memoryView.textureCoordinates.stride, 2, memoryView.pointCount,
+                memoryView.textureCoordinates.name.empty()
+                  ? "TCoords"
+                  : memoryView.textureCoordinates.name.c_str()));
           });
       }
 
@@ -588,14 +802,9 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
           f3d::mesh_view::dataTypeDispatch(scalar.type,
             [&]<typename DataT>()
             {
-              vtkNew<vtkStridedArray<DataT>> scalars;
-              scalars->SetName(scalar.name.c_str());
-              scalars->SetNumberOfComponents(static_cast<int>(scalar.components));
-              scalars->SetNumberOfTuples(memoryView.pointCount);
-              scalars->ConstructBackend(reinterpret_cast<const DataT*>(scalar.data), scalar.stride,
-                static_cast<int>(scalar.components));
-
-              polydata->GetPointData()->AddArray(scalars);
+              polydata->GetPointData()->AddArray(CreateArrayView<DataT>(scalar.data,
+                scalar.stride, static_cast<int>(scalar.components), memoryView.pointCount,
+                scalar.name.c_str()));
             });
         }
       }
@@ -607,15 +816,11 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
           f3d::mesh_view::dataTypeDispatch(scalar.type,
             [&]<typename DataT>()
             {
-              vtkNew<vtkStridedArray<DataT>> scalars;
-              scalars->SetName(scalar.name.c_str());
-              scalars->SetNumberOfComponents(static_cast<int>(scalar.components));
-              scalars->SetNumberOfTuples(memoryView.vertices.offsetCount +
-                memoryView.lines.offsetCount + memoryView.polygons.offsetCount - 3);
-              scalars->ConstructBackend(reinterpret_cast<const DataT*>(scalar.data), scalar.stride,
-                static_cast<int>(scalar.components));
-
-              polydata->GetCellData()->AddArray(scalars);
+              size_t cellCount = memoryView.vertices.offsetCount + memoryView.lines.offsetCount +
+                memoryView.polygons.offsetCount - 3;
+              polydata->GetCellData()->AddArray(CreateArrayView<DataT>(scalar.data,
+                scalar.stride, static_cast<int>(scalar.components), cellCount,
+                scalar.name.c_str()));
             });
         }
       }
@@ -679,21 +884,14 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
 
               vtkNew<vtkCellArray> cellArray;
 
-              vtkNew<vtkStridedArray<IndexingType>> faceOffsets;
-              faceOffsets->SetName(
-                cells.offsets.name.empty() ? "FaceOffsets" : cells.offsets.name.c_str());
-              faceOffsets->SetNumberOfTuples(cells.offsetCount);
-              faceOffsets->ConstructBackend(
-                reinterpret_cast<const IndexingType*>(cells.offsets.data), cells.offsets.stride);
-
-              vtkNew<vtkStridedArray<IndexingType>> faceIndices;
-              faceIndices->SetName(
-                cells.indices.name.empty() ? "FaceIndices" : cells.indices.name.c_str());
-              faceIndices->SetNumberOfTuples(cells.indexCount);
-              faceIndices->ConstructBackend(
-                reinterpret_cast<const IndexingType*>(cells.indices.data), cells.indices.stride);
-
-              cellArray->SetData(faceOffsets, faceIndices);
+              // Contiguous 32 and 64 bits indices are directly used as cell array storage
+              cellArray->SetData(
+                CreateArrayView<IndexingType>(cells.offsets.data, cells.offsets.stride, 1,
+                  cells.offsetCount,
+                  cells.offsets.name.empty() ? "FaceOffsets" : cells.offsets.name.c_str()),
+                CreateArrayView<IndexingType>(cells.indices.data, cells.indices.stride, 1,
+                  cells.indexCount,
+                  cells.indices.name.empty() ? "FaceIndices" : cells.indices.name.c_str()));
               return cellArray;
             }
             return nullptr;
@@ -719,6 +917,13 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
       }
     });
 
+  // Pick up the last state published before adding the stream
+  std::shared_ptr<mesh_stream> stream = std::dynamic_pointer_cast<mesh_stream>(mesh);
+  if (stream)
+  {
+    stream->acquire();
+  }
+
   try
   {
     vtkSource->Update();
@@ -731,6 +936,11 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
   vtkNew<vtkF3DGenericImporter> importer;
   importer->SetInternalReader(vtkSource);
 
+  if (stream)
+  {
+    this->Internals->Streams.emplace_back(stream, vtkSource);
+  }
+
   std::string name = mesh->getName();
 
   log::debug("Loading 3D scene from memory");
@@ -747,6 +957,8 @@ scene& scene_impl::clear()
 {
   // Clear the meta importer from all importers
   this->Internals->MetaImporter->Clear();
+  this->Internals->ImporterPaths.clear();
+  this->Internals->Streams.clear();
 
   // Clear the window of all actors
   this->Internals->Window.Initialize();
@@ -896,6 +1108,24 @@ std::vector<std::string> scene_impl::getAnimationNames()
   return this->Internals->AnimationManager.GetAnimationNames();
 }
 
+//----------------------------------------------------------------------------
+std::vector<file_memory_usage_t> scene_impl::getMemoryUsage() const
+{
+  std::vector<file_memory_usage_t> usages;
+  for (const auto& importerUsage : this->Internals->MetaImporter->GetMemoryUsage())
+  {
+    file_memory_usage_t usage;
+    usage.name = importerUsage.Name;
+    usage.usage = scene_impl::internals::ToMemoryUsage(importerUsage.Total);
+    for (const auto& actorUsage : importerUsage.Actors)
+    {
+      usage.actors.emplace_back(scene_impl::internals::ToMemoryUsage(actorUsage));
+    }
+    usages.emplace_back(std::move(usage));
+  }
+  return usages;
+}
+
 //----------------------------------------------------------------------------
 void scene_impl::SetInteractor(interactor_impl* interactor)
 {
@@ -904,6 +1134,47 @@ void scene_impl::SetInteractor(interactor_impl* interactor)
   this->Internals->Interactor->SetAnimationManager(&this->Internals->AnimationManager);
 }
 
+//----------------------------------------------------------------------------
+bool scene_impl::UpdateStreams()
+{
+  bool modified = false;
+  for (const auto& [stream, source] : this->Internals->Streams)
+  {
+    if (stream->acquire())
+    {
+      source->Modified();
+      modified = true;
+    }
+  }
+
+  try
+  {
+    return modified && this->Internals->MetaImporter->UpdateModifiedImporters();
+  }
+  catch (const load_failure_exception& e)
+  {
+    log::error("Failed to update streamed mesh: ", e.what());
+    return false;
+  }
+}
+
+//----------------------------------------------------------------------------
+void scene_impl::CheckMemoryBudget()
+{
+  const options& opt = this->Internals->Options;
+  std::optional<options>& checkedOptions = this->Internals->MemoryBudgetOptions;
+  if (!opt.scene.memory_budget.has_value() ||
+    (checkedOptions.has_value() && opt.isSame(checkedOptions.value(), "model")))
+  {
+    return;
+  }
+
+  // The visible normal glyphs, point sprites and volume depend on the model options
+  checkedOptions = opt;
+  this->Internals->CheckMemoryBudget(false);
+}
+
+//----------------------------------------------------------------------------
 void scene_impl::PrintImporterDescription(log::VerboseLevel level)
 {
   scene_impl::internals::DisplayImporterDescription(level, this->Internals->MetaImporter);
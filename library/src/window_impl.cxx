@@ -6,25 +6,30 @@
 #include "log.h"
 #include "macros.h"
 #include "options.h"
+#include "scene_impl.h"
 #include "utils.h"
 
 #include "F3DStyle.h"
+#include "F3DTrace.h"
 #include "vtkF3DExternalRenderWindow.h"
 
 #include "vtkF3DGenericImporter.h"
 #include "vtkF3DNoRenderWindow.h"
 #include "vtkF3DRenderer.h"
+#include "vtkF3DShaderCache.h"
 
 #include <vtkCamera.h>
 #include <vtkF3DRenderPass.h>
 #include <vtkImageData.h>
 #include <vtkImageExport.h>
 #include <vtkInformation.h>
+#include <vtkMath.h>
 #include <vtkPNGReader.h>
 #include <vtkPointGaussianMapper.h>
 #include <vtkRenderWindowInteractor.h>
 #include <vtkRendererCollection.h>
 #include <vtkRenderingOpenGLConfigure.h>
+#include <vtkUnsignedCharArray.h>
 #include <vtkVersion.h>
 #include <vtkWindowToImageFilter.h>
 
@@ -99,12 +104,98 @@ public:
 #endif
   }
 
+  /**
+   * Render the window as square tiles of tileSize pixels and stitch them into output.
+   * Each tile is rendered with an off-axis camera covering the tile and a margin around it,
+   * so that screen-space passes (SSAO, blur, ...) see the actual neighborhood at tile borders.
+   * Each tile accumulates up to samples TAA frames, like a render without tiles.
+   * The UI is hidden, as it would be displayed in each tile.
+   */
+  void RenderTiles(image& output, int tileSize, bool noBackground, int samples)
+  {
+    constexpr int margin = 32;
+    const int renderSize = tileSize + 2 * margin;
+    const int width = static_cast<int>(output.getWidth());
+    const int height = static_cast<int>(output.getHeight());
+    const int cmp = static_cast<int>(output.getChannelCount());
+    uint8_t* outBuffer = static_cast<uint8_t*>(output.getContent());
+
+    vtkCamera* cam = this->Renderer->GetActiveCamera();
+    const double viewAngle = cam->GetViewAngle();
+    const double parallelScale = cam->GetParallelScale();
+    double windowCenter[2];
+    cam->GetWindowCenter(windowCenter);
+    const double tanHalfAngle = std::tan(vtkMath::RadiansFromDegrees(viewAngle) / 2.0);
+    const double angleSize = cam->GetUseHorizontalViewAngle() ? width : height;
+
+    this->RenWin->SetSize(renderSize, renderSize);
+    this->Renderer->SetUIHidden(true);
+
+    // Each tile is copied right after its readback, the copy is negligible compared to the render
+    vtkNew<vtkUnsignedCharArray> pixels;
+    for (int y0 = 0; y0 < height; y0 += tileSize)
+    {
+      for (int x0 = 0; x0 < width; x0 += tileSize)
+      {
+        // Center of the rendered region in normalized device coordinates of the full image,
+        // converted in units of the tile frustum half extent
+        const double centerX = 2.0 * (x0 - margin + renderSize / 2.0) / width - 1.0;
+        const double centerY = 2.0 * (y0 - margin + renderSize / 2.0) / height - 1.0;
+        cam->SetWindowCenter((centerX + windowCenter[0]) * width / renderSize,
+          (centerY + windowCenter[1]) * height / renderSize);
+        cam->SetViewAngle(vtkMath::DegreesFromRadians(
+          2.0 * std::atan(tanHalfAngle * renderSize / angleSize)));
+        cam->SetParallelScale(parallelScale * renderSize / height);
+
+        // Temporal accumulation must not blend the previous tile
+        this->Renderer->ResetTemporalAccumulation();
+        this->RenWin->Render();
+        for (int i = 1; i < samples && !this->Renderer->IsRenderConverged(); i++)
+        {
+          this->RenWin->Render();
+        }
+
+        if (noBackground)
+        {
+          this->RenWin->GetRGBACharPixelData(0, 0, renderSize - 1, renderSize - 1, 1, pixels);
+        }
+        else
+        {
+          this->RenWin->GetPixelData(0, 0, renderSize - 1, renderSize - 1, 1, pixels);
+        }
+
+        const int tileWidth = std::min(tileSize, width - x0);
+        const int tileHeight = std::min(tileSize, height - y0);
+        for (int y = 0; y < tileHeight; y++)
+        {
+          const uint8_t* row =
+            pixels->GetPointer((static_cast<vtkIdType>(y + margin) * renderSize + margin) * cmp);
+          std::copy_n(
+            row, tileWidth * cmp, outBuffer + (static_cast<size_t>(y0 + y) * width + x0) * cmp);
+        }
+      }
+    }
+
+    cam->SetWindowCenter(windowCenter[0], windowCenter[1]);
+    cam->SetViewAngle(viewAngle);
+    cam->SetParallelScale(parallelScale);
+    this->Renderer->SetUIHidden(false);
+    this->RenWin->SetSize(width, height);
+  }
+
   std::unique_ptr<camera_impl> Camera;
   vtkSmartPointer<vtkRenderWindow> RenWin;
   vtkNew<vtkF3DRenderer> Renderer;
   const options& Options;
   interactor_impl* Interactor = nullptr;
+  scene_impl* Scene = nullptr;
   fs::path CachePath;
+
+  // Options as they were when last applied to the renderer, unset if never applied
+  std::optional<options> AppliedOptions;
+
+  // UI options depend on the interactor bindings, reapplied when they change
+  bool UIOptionsInvalid = false;
   context::function GetProcAddress;
 };
 
@@ -169,6 +260,9 @@ window_impl::window_impl(const options& options, const std::optional<Type>& type
     {
       oglRenWin->SetOpenGLSymbolLoader(&internals::SymbolLoader, &this->Internals->GetProcAddress);
     }
+
+    // Program binaries are stored in the cache directory once it is set
+    vtkF3DShaderCache::Install(oglRenWin);
   }
 
   this->Internals->RenWin->EnableTranslucentSurfaceOn();
@@ -353,6 +447,12 @@ point3_t window_impl::getDisplayFromWorld(const point3_t& worldPoint) const
   return out;
 }
 
+//----------------------------------------------------------------------------
+std::vector<std::pair<std::string, double>> window_impl::getFrameTimings() const
+{
+  return this->Internals->Renderer->GetFrameTimings();
+}
+
 //----------------------------------------------------------------------------
 window_impl::~window_impl()
 {
@@ -391,8 +491,78 @@ void window_impl::UpdateDynamicOptions()
 
   const options& opt = this->Internals->Options;
 
-  // Update pending up direction if changed
-  renderer->SetPendingUpDirection(opt.scene.up_direction);
+  // Only apply the groups of options that changed since they were last applied,
+  // renderer setters are no-op when the value does not change
+  const std::optional<options>& applied = this->Internals->AppliedOptions;
+  const bool sceneChanged = !applied || !opt.isSame(*applied, "scene");
+  const bool modelChanged = !applied || !opt.isSame(*applied, "model");
+  const bool renderChanged = !applied || !opt.isSame(*applied, "render");
+  const bool uiChanged =
+    !applied || this->Internals->UIOptionsInvalid || !opt.isSame(*applied, "ui");
+  const bool interactorChanged = !applied || !opt.isSame(*applied, "interactor");
+
+  if (sceneChanged)
+  {
+    // Update pending up direction if changed
+    renderer->SetPendingUpDirection(opt.scene.up_direction);
+
+    if (!opt.scene.camera.index.has_value())
+    {
+      renderer->SetUseOrthographicProjection(opt.scene.camera.orthographic);
+    }
+  }
+
+  if (modelChanged || renderChanged)
+  {
+    this->UpdateModelOptions();
+  }
+
+  if (renderChanged)
+  {
+    this->UpdateRenderOptions();
+  }
+
+  if (uiChanged || (this->Internals->Interactor && interactorChanged))
+  {
+    this->UpdateUIOptions();
+    this->Internals->UIOptionsInvalid = false;
+  }
+
+  if (sceneChanged || modelChanged || renderChanged || uiChanged || interactorChanged)
+  {
+    this->Internals->AppliedOptions = opt;
+  }
+
+  renderer->UpdateActors();
+
+  // Update the cheatsheet if needed
+  if (this->Internals->Interactor && renderer->CheatSheetNeedsUpdate())
+  {
+    std::vector<vtkF3DUIActor::CheatSheetGroup> cheatsheet;
+    for (const std::string& group : this->Internals->Interactor->getBindGroups())
+    {
+      std::vector<vtkF3DUIActor::CheatSheetTuple> groupList;
+      for (const interaction_bind_t& bind : this->Internals->Interactor->getBindsForGroup(group))
+      {
+        auto [doc, val] = this->Internals->Interactor->getBindingDocumentation(bind);
+        f3d::interactor::BindingType type = this->Internals->Interactor->getBindingType(bind);
+        if (!doc.empty())
+        {
+          groupList.emplace_back(
+            std::make_tuple(bind.format(), doc, val, vtkF3DUIActor::CheatSheetBindingType(type)));
+        }
+      }
+      cheatsheet.emplace_back(std::make_pair(group, std::move(groupList)));
+    }
+    renderer->ConfigureCheatSheet(cheatsheet);
+  }
+}
+
+//----------------------------------------------------------------------------
+void window_impl::UpdateModelOptions()
+{
+  vtkF3DRenderer* renderer = this->Internals->Renderer;
+  const options& opt = this->Internals->Options;
 
   renderer->SetUseNormalGlyphs(opt.model.normal_glyphs.enable);
   renderer->SetNormalGlyphScaleMultiplier(opt.model.normal_glyphs.scale);
@@ -447,81 +617,45 @@ void window_impl::UpdateDynamicOptions()
       opt.render.effect.blending.mode != "sort" && opt.render.effect.blending.mode != "sort_cpu");
   }
 
-  renderer->SetLineWidth(opt.render.line_width);
-  renderer->SetPointSize(opt.render.point_size);
-  renderer->ShowEdge(opt.render.show_edges);
-  renderer->ShowTimer(opt.ui.fps);
-  renderer->ShowFilename(opt.ui.filename);
-  renderer->SetFilenameInfo(opt.ui.filename_info);
-  renderer->ShowMetaData(opt.ui.metadata);
-  renderer->ShowHDRIFilename(opt.ui.hdri_filename);
-  renderer->ShowSceneHierarchy(opt.ui.scene_hierarchy);
-  renderer->ShowCheatSheet(opt.ui.cheatsheet);
-  renderer->ShowConsole(opt.ui.console);
-  renderer->ShowMinimalConsole(opt.ui.minimal_console);
-  renderer->ShowDropZone(opt.ui.drop_zone.enable);
-  renderer->ShowDropZoneLogo(opt.ui.drop_zone.show_logo);
-  renderer->SetBackdropColor(opt.ui.backdrop.color);
-  renderer->SetBackdropOpacity(opt.ui.backdrop.opacity);
-  renderer->ShowNotification(opt.ui.notifications.enable);
-  renderer->ShowBindings(opt.ui.notifications.show_bindings);
-
-  if (this->Internals->Interactor)
-  {
-    renderer->SetAxesColor(opt.ui.x_color, opt.ui.y_color, opt.ui.z_color);
-    renderer->ShowAxis(opt.ui.axis);
-    renderer->SetInvertZoom(opt.interactor.invert_zoom);
-    renderer->SetInteractionStyle(opt.interactor.style);
-
-#if F3D_MODULE_UI
-    std::string bindsStr = opt.ui.drop_zone.custom_binds;
-    std::vector<std::pair<std::string, std::string>> dropZoneBinds;
+  renderer->SetSurfaceColor(opt.model.color.rgb);
+  renderer->SetOpacity(opt.model.color.opacity);
+  renderer->SetTextureBaseColor(opt.model.color.texture);
+  renderer->SetTexturesTransform(opt.model.textures_transform);
+  renderer->SetRoughness(opt.model.material.roughness);
+  renderer->SetMetallic(opt.model.material.metallic);
+  renderer->SetBaseIOR(opt.model.material.base_ior);
+  renderer->SetTextureMaterial(opt.model.material.texture);
+  renderer->SetTextureEmissive(opt.model.emissive.texture);
+  renderer->SetEmissiveFactor(opt.model.emissive.factor);
+  renderer->SetTextureNormal(opt.model.normal.texture);
+  renderer->SetNormalScale(opt.model.normal.scale);
+  renderer->SetTextureMatCap(opt.model.matcap.texture);
+  renderer->SetEnableCheckerBoard(opt.model.checkerboard.enable);
+  renderer->SetUnlit(opt.model.unlit);
 
-    for (const std::string& token : utils::tokenize(bindsStr))
-    {
-      if (!token.empty())
-      {
-        try
-        {
-          auto bind = interaction_bind_t::parse(token);
-          auto docPair = this->Internals->Interactor->getBindingDocumentation(bind);
-          dropZoneBinds.push_back({ docPair.first, bind.format() });
-        }
-        catch (const interactor_impl::does_not_exists_exception&)
-        {
-          // skip non-existent binds
-          log::warn("Bind ", token, " does not exist and will be ignored.");
-        }
-      }
-    }
-    renderer->SetDropZoneBinds(dropZoneBinds);
-#endif
-  }
+  renderer->SetEnableColoring(opt.model.scivis.enable);
+  renderer->SetUseCellColoring(opt.model.scivis.cells);
+  renderer->SetArrayNameForColoring(opt.model.scivis.array_name);
+  renderer->SetComponentForColoring(opt.model.scivis.component);
 
-  // F3D_DEPRECATED
-  // Remove this in the next major release
-  F3D_SILENT_WARNING_PUSH()
-  F3D_SILENT_WARNING_DECL(4996, "deprecated-declarations")
+  renderer->SetScalarBarRange(opt.model.scivis.range);
+  renderer->SetColormap(opt.model.scivis.colormap);
+  renderer->SetColormapDiscretization(opt.model.scivis.discretization);
+  renderer->SetOpacityMap(opt.model.scivis.opacity_map);
 
-  if (!opt.ui.dropzone_info.empty())
-  {
-    log::warn("'ui.dropzone_info' is deprecated. Please Use 'ui.drop_zone.custom_binds' instead.");
-    renderer->SetDropZoneInfo(opt.ui.dropzone_info);
-  }
-  else if (!opt.ui.drop_zone.info.empty())
-  {
-    log::warn("'ui.drop_zone.info' is deprecated. Please Use 'ui.drop_zone.custom_binds' instead.");
-    renderer->SetDropZoneInfo(opt.ui.drop_zone.info);
-  }
+  renderer->SetUseVolume(opt.model.volume.enable);
+  renderer->SetUseInverseOpacityFunction(opt.model.volume.inverse);
+}
 
-  if (opt.ui.dropzone)
-  {
-    log::warn("'ui.dropzone' is deprecated. Please Use 'ui.drop_zone.enable' instead.");
-    renderer->ShowDropZone(opt.ui.dropzone);
-    renderer->ShowDropZoneLogo(opt.ui.dropzone);
-  }
-  F3D_SILENT_WARNING_POP()
+//----------------------------------------------------------------------------
+void window_impl::UpdateRenderOptions()
+{
+  vtkF3DRenderer* renderer = this->Internals->Renderer;
+  const options& opt = this->Internals->Options;
 
+  renderer->SetLineWidth(opt.render.line_width);
+  renderer->SetPointSize(opt.render.point_size);
+  renderer->ShowEdge(opt.render.show_edges);
   renderer->ShowArmature(opt.render.armature.enable);
 
   renderer->SetUseRaytracing(opt.render.raytracing.enable);
@@ -580,6 +714,7 @@ void window_impl::UpdateDynamicOptions()
 
   renderer->SetUseSSAOPass(opt.render.effect.ambient_occlusion);
   renderer->SetAntiAliasingMode(aaMode);
+  renderer->SetTAASamples(opt.render.effect.antialiasing.samples);
   renderer->SetUseToneMappingPass(opt.render.effect.tone_mapping);
   renderer->SetDisplayDepth(opt.render.effect.display_depth);
   renderer->SetBlendingMode(blendMode);
@@ -595,6 +730,96 @@ void window_impl::UpdateDynamicOptions()
   renderer->SetUseImageBasedLighting(opt.render.hdri.ambient);
   renderer->ShowHDRISkybox(opt.render.background.skybox);
 
+  renderer->SetGridUnitSquare(opt.render.grid.unit);
+  renderer->SetGridSubdivisions(opt.render.grid.subdivisions);
+  renderer->SetGridAbsolute(opt.render.grid.absolute);
+  renderer->SetGridReflection(opt.render.grid.reflection);
+  renderer->SetGridReflectionResolution(opt.render.grid.reflection_resolution);
+  renderer->ShowGrid(opt.render.grid.enable);
+  renderer->SetGridColor(opt.render.grid.color);
+
+  renderer->ShowAxesGrid(opt.render.axes_grid.enable);
+}
+
+//----------------------------------------------------------------------------
+void window_impl::UpdateUIOptions()
+{
+  vtkF3DRenderer* renderer = this->Internals->Renderer;
+  const options& opt = this->Internals->Options;
+
+  renderer->ShowTimer(opt.ui.fps);
+  renderer->ShowFilename(opt.ui.filename);
+  renderer->SetFilenameInfo(opt.ui.filename_info);
+  renderer->ShowMetaData(opt.ui.metadata);
+  renderer->ShowMetaDataMemory(opt.ui.metadata_memory);
+  renderer->ShowHDRIFilename(opt.ui.hdri_filename);
+  renderer->ShowSceneHierarchy(opt.ui.scene_hierarchy);
+  renderer->ShowCheatSheet(opt.ui.cheatsheet);
+  renderer->ShowConsole(opt.ui.console);
+  renderer->ShowMinimalConsole(opt.ui.minimal_console);
+  renderer->ShowDropZone(opt.ui.drop_zone.enable);
+  renderer->ShowDropZoneLogo(opt.ui.drop_zone.show_logo);
+  renderer->SetBackdropColor(opt.ui.backdrop.color);
+  renderer->SetBackdropOpacity(opt.ui.backdrop.opacity);
+  renderer->ShowNotification(opt.ui.notifications.enable);
+  renderer->ShowBindings(opt.ui.notifications.show_bindings);
+
+  if (this->Internals->Interactor)
+  {
+    renderer->SetAxesColor(opt.ui.x_color, opt.ui.y_color, opt.ui.z_color);
+    renderer->ShowAxis(opt.ui.axis);
+    renderer->SetInvertZoom(opt.interactor.invert_zoom);
+    renderer->SetInteractionStyle(opt.interactor.style);
+
+#if F3D_MODULE_UI
+    std::string bindsStr = opt.ui.drop_zone.custom_binds;
+    std::vector<std::pair<std::string, std::string>> dropZoneBinds;
+
+    for (const std::string& token : utils::tokenize(bindsStr))
+    {
+      if (!token.empty())
+      {
+        try
+        {
+          auto bind = interaction_bind_t::parse(token);
+          auto docPair = this->Internals->Interactor->getBindingDocumentation(bind);
+          dropZoneBinds.push_back({ docPair.first, bind.format() });
+        }
+        catch (const interactor_impl::does_not_exists_exception&)
+        {
+          // skip non-existent binds
+          log::warn("Bind ", token, " does not exist and will be ignored.");
+        }
+      }
+    }
+    renderer->SetDropZoneBinds(dropZoneBinds);
+#endif
+  }
+
+  // F3D_DEPRECATED
+  // Remove this in the next major release
+  F3D_SILENT_WARNING_PUSH()
+  F3D_SILENT_WARNING_DECL(4996, "deprecated-declarations")
+
+  if (!opt.ui.dropzone_info.empty())
+  {
+    log::warn("'ui.dropzone_info' is deprecated. Please Use 'ui.drop_zone.custom_binds' instead.");
+    renderer->SetDropZoneInfo(opt.ui.dropzone_info);
+  }
+  else if (!opt.ui.drop_zone.info.empty())
+  {
+    log::warn("'ui.drop_zone.info' is deprecated. Please Use 'ui.drop_zone.custom_binds' instead.");
+    renderer->SetDropZoneInfo(opt.ui.drop_zone.info);
+  }
+
+  if (opt.ui.dropzone)
+  {
+    log::warn("'ui.dropzone' is deprecated. Please Use 'ui.drop_zone.enable' instead.");
+    renderer->ShowDropZone(opt.ui.dropzone);
+    renderer->ShowDropZoneLogo(opt.ui.dropzone);
+  }
+  F3D_SILENT_WARNING_POP()
+
   renderer->SetFontFile(opt.ui.font_file);
   renderer->SetFontScale(opt.ui.scale);
   renderer->SetFontColor(opt.ui.font_color);
@@ -616,74 +841,7 @@ void window_impl::UpdateDynamicOptions()
   }
   renderer->SetAnimationProgressMode(animationProgressMode);
   renderer->SetDPIAware(opt.ui.dpi_aware);
-
-  renderer->SetGridUnitSquare(opt.render.grid.unit);
-  renderer->SetGridSubdivisions(opt.render.grid.subdivisions);
-  renderer->SetGridAbsolute(opt.render.grid.absolute);
-  renderer->SetGridReflection(opt.render.grid.reflection);
-  renderer->ShowGrid(opt.render.grid.enable);
-  renderer->SetGridColor(opt.render.grid.color);
-
-  renderer->ShowAxesGrid(opt.render.axes_grid.enable);
-
-  if (!opt.scene.camera.index.has_value())
-  {
-    renderer->SetUseOrthographicProjection(opt.scene.camera.orthographic);
-  }
-
-  renderer->SetSurfaceColor(opt.model.color.rgb);
-  renderer->SetOpacity(opt.model.color.opacity);
-  renderer->SetTextureBaseColor(opt.model.color.texture);
-  renderer->SetTexturesTransform(opt.model.textures_transform);
-  renderer->SetRoughness(opt.model.material.roughness);
-  renderer->SetMetallic(opt.model.material.metallic);
-  renderer->SetBaseIOR(opt.model.material.base_ior);
-  renderer->SetTextureMaterial(opt.model.material.texture);
-  renderer->SetTextureEmissive(opt.model.emissive.texture);
-  renderer->SetEmissiveFactor(opt.model.emissive.factor);
-  renderer->SetTextureNormal(opt.model.normal.texture);
-  renderer->SetNormalScale(opt.model.normal.scale);
-  renderer->SetTextureMatCap(opt.model.matcap.texture);
-  renderer->SetEnableCheckerBoard(opt.model.checkerboard.enable);
-  renderer->SetUnlit(opt.model.unlit);
-
-  renderer->SetEnableColoring(opt.model.scivis.enable);
-  renderer->SetUseCellColoring(opt.model.scivis.cells);
-  renderer->SetArrayNameForColoring(opt.model.scivis.array_name);
-  renderer->SetComponentForColoring(opt.model.scivis.component);
-
-  renderer->SetScalarBarRange(opt.model.scivis.range);
-  renderer->SetColormap(opt.model.scivis.colormap);
-  renderer->SetColormapDiscretization(opt.model.scivis.discretization);
-  renderer->SetOpacityMap(opt.model.scivis.opacity_map);
   renderer->ShowScalarBar(opt.ui.scalar_bar);
-
-  renderer->SetUseVolume(opt.model.volume.enable);
-  renderer->SetUseInverseOpacityFunction(opt.model.volume.inverse);
-
-  renderer->UpdateActors();
-
-  // Update the cheatsheet if needed
-  if (this->Internals->Interactor && renderer->CheatSheetNeedsUpdate())
-  {
-    std::vector<vtkF3DUIActor::CheatSheetGroup> cheatsheet;
-    for (const std::string& group : this->Internals->Interactor->getBindGroups())
-    {
-      std::vector<vtkF3DUIActor::CheatSheetTuple> groupList;
-      for (const interaction_bind_t& bind : this->Internals->Interactor->getBindsForGroup(group))
-      {
-        auto [doc, val] = this->Internals->Interactor->getBindingDocumentation(bind);
-        f3d::interactor::BindingType type = this->Internals->Interactor->getBindingType(bind);
-        if (!doc.empty())
-        {
-          groupList.emplace_back(
-            std::make_tuple(bind.format(), doc, val, vtkF3DUIActor::CheatSheetBindingType(type)));
-        }
-      }
-      cheatsheet.emplace_back(std::make_pair(group, std::move(groupList)));
-    }
-    renderer->ConfigureCheatSheet(cheatsheet);
-  }
 }
 
 //----------------------------------------------------------------------------
@@ -709,9 +867,22 @@ vtkRenderWindow* window_impl::GetRenderWindow()
 }
 
 //----------------------------------------------------------------------------
-bool window_impl::render()
+void window_impl::PrepareRender()
 {
+  // Without an interactor, nothing else picks up the newest states of streamed meshes
+  if (this->Internals->Scene)
+  {
+    this->Internals->Scene->UpdateStreams();
+  }
+
   this->UpdateDynamicOptions();
+
+  // The auxiliary memory depends on the visibility configured by the dynamic options
+  if (this->Internals->Scene)
+  {
+    this->Internals->Scene->CheckMemoryBudget();
+  }
+
   const options& opt = this->Internals->Options;
   if ((!opt.scene.camera.index.has_value()) && (!this->Internals->Camera->GetSuccessfullyReset()))
   {
@@ -719,6 +890,13 @@ bool window_impl::render()
     // options will enable successful reset of camera
     this->Internals->Camera->resetToBounds();
   }
+}
+
+//----------------------------------------------------------------------------
+bool window_impl::render()
+{
+  F3DTrace::Scope trace("window::render", "render");
+  this->PrepareRender();
   this->Internals->RenWin->Render();
   return true;
 }
@@ -726,8 +904,38 @@ bool window_impl::render()
 //----------------------------------------------------------------------------
 image window_impl::renderToImage(bool noBackground)
 {
+  const options& opt = this->Internals->Options;
+  const int* size = this->Internals->RenWin->GetSize();
+  if (opt.render.tile_size.has_value() && opt.render.tile_size.value() > 0 &&
+    (size[0] > opt.render.tile_size.value() || size[1] > opt.render.tile_size.value()))
+  {
+    image output(size[0], size[1], noBackground ? 4 : 3);
+
+    // Never render at the full size, it may exceed the framebuffer limits
+    this->PrepareRender();
+    if (noBackground)
+    {
+      this->Internals->Renderer->SetBackground(0, 0, 0);
+    }
+    this->Internals->RenderTiles(output, opt.render.tile_size.value(), noBackground,
+      opt.render.effect.antialiasing.samples);
+    if (noBackground)
+    {
+      this->Internals->Renderer->SetBackground(opt.render.background.color.data());
+    }
+    return output;
+  }
+
   this->render();
 
+  // Accumulate TAA samples until the image is stable, a sample count of 0 never converges
+  for (int i = 1; i < opt.render.effect.antialiasing.samples &&
+       !this->Internals->Renderer->IsRenderConverged();
+       i++)
+  {
+    this->Internals->RenWin->Render();
+  }
+
   vtkNew<vtkWindowToImageFilter> rtW2if;
   rtW2if->SetInput(this->Internals->RenWin);
 
@@ -749,6 +957,12 @@ image window_impl::renderToImage(bool noBackground)
   image output(dims[0], dims[1], cmp);
   exporter->Export(output.getContent());
 
+  if (noBackground)
+  {
+    // Render options are only applied when they change, restore the background explicitly
+    this->Internals->Renderer->SetBackground(opt.render.background.color.data());
+  }
+
   return output;
 }
 
@@ -770,6 +984,7 @@ void window_impl::SetCachePath(const fs::path& cachePath)
 
     // create directories if they do not exist
     fs::create_directories(cachePath);
+    fs::create_directories(cachePath / "shaders");
   }
   catch (const fs::filesystem_error& ex)
   {
@@ -777,18 +992,45 @@ void window_impl::SetCachePath(const fs::path& cachePath)
   }
 
   this->Internals->CachePath = cachePath;
+
+  vtkOpenGLRenderWindow* oglRenWin = vtkOpenGLRenderWindow::SafeDownCast(this->Internals->RenWin);
+  if (oglRenWin)
+  {
+    vtkF3DShaderCache* shaderCache = vtkF3DShaderCache::SafeDownCast(oglRenWin->GetShaderCache());
+    if (shaderCache)
+    {
+      shaderCache->SetCacheDirectory((cachePath / "shaders").string());
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void window_impl::SetScene(scene_impl* scene)
+{
+  this->Internals->Scene = scene;
+}
+
+//----------------------------------------------------------------------------
+void window_impl::InvalidateUIOptions()
+{
+  this->Internals->UIOptionsInvalid = true;
 }
 
 //----------------------------------------------------------------------------
 void window_impl::SetInteractor(interactor_impl* interactor)
 {
   this->Internals->Interactor = interactor;
+
+  // Some options are only applied when there is an interactor
+  this->Internals->AppliedOptions.reset();
 }
 
 //----------------------------------------------------------------------------
 void window_impl::RenderUIOnly()
 {
 #if F3D_MODULE_UI
+  F3DTrace::Scope trace("window::renderUIOnly", "render");
+
   // Do only a partial render of the UI
   vtkRenderWindow* renWin = this->Internals->RenWin;
   vtkRenderer* ren = renWin->GetRenderers()->GetFirstRenderer();
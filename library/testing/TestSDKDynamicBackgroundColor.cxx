@@ -2,6 +2,7 @@
 #include "TestSDKHelpers.h"
 
 #include <engine.h>
+#include <image.h>
 #include <options.h>
 #include <scene.h>
 #include <window.h>
@@ -28,5 +29,11 @@ int TestSDKDynamicBackgroundColor([[maybe_unused]] int argc, [[maybe_unused]] ch
   test("Render with dynamic background color",
     TestSDKHelpers::RenderTest(eng.getWindow(), std::string(argv[1]) + "baselines/",
       std::string(argv[2]), "TestSDKDynamicBackgrounColor"));
+
+  // Rendering without background must not change the background of the next renders
+  f3d::image noBackground = win.renderToImage(true);
+  test("Background is transparent", noBackground.getNormalizedPixel({ 0, 0 })[3], 0.0);
+  test("Background color is restored", win.renderToImage().getNormalizedPixel({ 0, 0 }),
+    std::vector<double>{ 1.0, 1.0, 1.0 });
   return test.result();
 }
@@ -50,7 +50,7 @@ int TestSDKDynamicHDRI([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
       std::string(argv[2]), "TestSDKDynamicHDRI"));
 
   // Check caching is working
-  std::ifstream lutFile(cachePath + "/lut.vti");
+  std::ifstream lutFile(cachePath + "/lut.f3dtex");
   test("open lut cache file", lutFile.is_open());
 
   // Force a cache path change to force a LUT reconfiguration and test dynamic cache path
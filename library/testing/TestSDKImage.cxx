@@ -255,6 +255,24 @@ int TestSDKImage([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
 
   f3d::image empty(0, 0, 0);
   test("compare empty images", empty.compare(empty), 0.);
+  test("compare identical images", generated.compare(generated), 0.);
+
+  // Test image::compareTiles, only the last tile differs
+  test("compare tiles with different size", generated.compareTiles(generatedSize).size(),
+    size_t{ 1 });
+  test("compare tiles of empty images", empty.compareTiles(empty).empty());
+
+  f3d::image modified(width, height, channels);
+  std::vector<uint8_t> modifiedPixels = pixels;
+  std::fill_n(modifiedPixels.end() - 8 * channels, 8 * channels, 0);
+  modified.setContent(modifiedPixels.data());
+
+  std::vector<double> tileErrors = modified.compareTiles(generated, 16);
+  test("compare tiles count", tileErrors.size(), size_t{ 16 });
+  test("compare tiles identical", std::all_of(tileErrors.begin(), tileErrors.end() - 1,
+                                    [](double error) { return error == 0.; }));
+  test("compare tiles different", tileErrors.back() > 0.);
+  test("compare tiles cropped", modified.compareTiles(generated, 48).size(), size_t{ 4 });
 
   return test.result();
 }
@@ -0,0 +1,79 @@
+#include "PseudoUnitTest.h"
+
+#include <engine.h>
+#include <interactor.h>
+#include <options.h>
+#include <scene.h>
+#include <window.h>
+
+#include <string>
+
+namespace
+{
+// Count full and UI only renders recorded in the trace
+int CountRenders(const std::string& trace)
+{
+  int count = 0;
+  for (const std::string name : { "\"window::render\"", "\"window::renderUIOnly\"" })
+  {
+    for (size_t pos = trace.find(name); pos != std::string::npos; pos = trace.find(name, pos + 1))
+    {
+      count++;
+    }
+  }
+  return count;
+}
+}
+
+int TestSDKInteractorIdle([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::engine eng = f3d::engine::create(true);
+  f3d::window& win = eng.getWindow();
+  f3d::options& opt = eng.getOptions();
+  f3d::interactor& inter = eng.getInteractor();
+
+  win.setSize(300, 300);
+  eng.getScene().add(std::string(argv[1]) + "data/cow.vtp");
+  win.render();
+
+  // Let the first ticks render the UI once
+  inter.triggerEventLoop(1.0 / 30);
+  inter.triggerEventLoop(1.0 / 30);
+
+  f3d::engine::setTracing(true);
+  for (int i = 0; i < 10; i++)
+  {
+    inter.triggerEventLoop(1.0 / 30);
+  }
+  test("no render when idle", CountRenders(f3d::engine::getTrace()), 0);
+
+  inter.triggerKeyboardKey(f3d::interactor::InputAction::PRESS, "G");
+  inter.triggerKeyboardKey(f3d::interactor::InputAction::RELEASE, "G");
+  inter.triggerEventLoop(1.0 / 30);
+  const int inputRenders = CountRenders(f3d::engine::getTrace());
+  test("render after an input", inputRenders > 0);
+
+  for (int i = 0; i < 10; i++)
+  {
+    inter.triggerEventLoop(1.0 / 30);
+  }
+  test("no render when idle after an input", CountRenders(f3d::engine::getTrace()), inputRenders);
+
+  opt.render.background.color = { 1.0, 1.0, 1.0 };
+  inter.requestRender();
+  inter.triggerEventLoop(1.0 / 30);
+  const int optionRenders = CountRenders(f3d::engine::getTrace());
+  test("render after an option change", optionRenders, inputRenders + 1);
+
+  for (int i = 0; i < 10; i++)
+  {
+    inter.triggerEventLoop(1.0 / 30);
+  }
+  test("no render when idle after an option change", CountRenders(f3d::engine::getTrace()),
+    optionRenders);
+
+  f3d::engine::setTracing(false);
+  return test.result();
+}
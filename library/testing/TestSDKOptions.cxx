@@ -328,6 +328,17 @@ int TestSDKOptions([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
   opt2.copy(opt, "render.background.color");
   test("copy with vectors", opt2.render.background.color == f3d::color_t({ 0.1, 0.2, 0.7 }));
 
+  // Test isSame with groups
+  test("isSame with group", opt.isSame(opt2, "render.background"));
+
+  opt2.render.background.blur.coc = 42;
+  test("not isSame with group", !opt.isSame(opt2, "render.background"));
+  test("not isSame with parent group", !opt.isSame(opt2, "render"));
+  test("isSame with other group", opt.isSame(opt2, "model"));
+
+  opt2.copy(opt, "render.background.blur.coc");
+  test("isSame with group after copy", opt.isSame(opt2, "render"));
+
   // Test isSame/copy error path
   test.expect<f3d::options::inexistent_exception>(
     "inexistent_exception exception on isSame", [&]() { std::ignore = opt.isSame(opt2, "dummy"); });
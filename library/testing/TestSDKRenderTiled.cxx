@@ -0,0 +1,74 @@
+#include "PseudoUnitTest.h"
+
+#include <engine.h>
+#include <image.h>
+#include <options.h>
+#include <scene.h>
+#include <window.h>
+
+#include <iostream>
+
+int TestSDKRenderTiled([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::engine eng = f3d::engine::create(true);
+
+  f3d::window& win = eng.getWindow();
+  win.setSize(300, 200);
+
+  f3d::scene& sce = eng.getScene();
+  sce.add(std::string(argv[1]) + "/data/cow.vtp");
+
+  f3d::options& options = eng.getOptions();
+  options.render.effect.ambient_occlusion = true;
+
+  f3d::image reference = win.renderToImage();
+
+  // 128 pixels tiles, the last row and column of tiles are cropped
+  options.render.tile_size = 128;
+  f3d::image tiled = win.renderToImage();
+
+  test("tiled render size", tiled.getWidth() == 300 && tiled.getHeight() == 200);
+  test("window size restored", win.getWidth() == 300 && win.getHeight() == 200);
+
+  const double error = tiled.compare(reference);
+  if (error > 0.05)
+  {
+    std::cerr << "Tiled rendering difference: " << error << "\n";
+    tiled.save(std::string(argv[2]) + "/TestSDKRenderTiled.png");
+  }
+  test("tiled render matches", error <= 0.05);
+
+  f3d::image tiledNoBackground = win.renderToImage(true);
+  test("tiled render without background", tiledNoBackground.getChannelCount(), 4U);
+
+  // Tiles larger than the window are not used
+  options.render.tile_size = 512;
+  test("tile size larger than window", win.renderToImage().compare(reference) <= 0.05);
+
+  // TAA samples are accumulated on each tile
+  options.render.tile_size.reset();
+  options.render.effect.antialiasing.mode = "taa";
+  f3d::image taaReference = win.renderToImage();
+  options.render.tile_size = 128;
+  const double taaError = win.renderToImage().compare(taaReference);
+  if (taaError > 0.05)
+  {
+    std::cerr << "Tiled TAA rendering difference: " << taaError << "\n";
+  }
+  test("tiled TAA render matches", taaError <= 0.05);
+
+  // The UI is not rendered in each tile
+  options.render.tile_size.reset();
+  options.render.effect.antialiasing.mode = "none";
+  options.ui.axis = true;
+  f3d::image axisReference = win.renderToImage();
+  test("axis displayed without tiles", axisReference != reference);
+  options.render.tile_size = 128;
+  test("axis hidden in tiles", win.renderToImage().compare(reference) <= 0.05);
+  options.render.tile_size.reset();
+  test("axis displayed again after tiles", win.renderToImage() == axisReference);
+
+  return test.result();
+}
@@ -99,6 +99,15 @@ int TestSDKScene([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
   test("render after add",
     TestSDKHelpers::RenderTest(win, std::string(argv[1]) + "baselines/", argv[2], "TestSDKScene"));
 
+  // reload test, the scene must be unchanged
+  test.expect<f3d::scene::load_failure_exception>(
+    "reload with a file not added", [&]() { sce.reload(validFilename); });
+  test.expect<f3d::scene::load_failure_exception>(
+    "reload with empty file", [&]() { sce.reload(empty); });
+  test("reload with an added file", [&]() { sce.reload(sphere2); });
+  test("render after reload",
+    TestSDKHelpers::RenderTest(win, std::string(argv[1]) + "baselines/", argv[2], "TestSDKScene"));
+
   // light test
   f3d::light_state_t defaultLight;
   f3d::light_state_t redLight = defaultLight;
@@ -141,5 +150,52 @@ int TestSDKScene([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
     TestSDKHelpers::RenderTest(
       win, std::string(argv[1]) + "baselines/", argv[2], "TestSDKSceneRedLight"));
 
+  // memory usage test
+  std::vector<f3d::file_memory_usage_t> usages = sce.getMemoryUsage();
+  test("memory usage of each file", !usages.empty());
+  for (const f3d::file_memory_usage_t& usage : usages)
+  {
+    std::uint64_t actorsTotal = 0;
+    for (const f3d::memory_usage_t& actor : usage.actors)
+    {
+      actorsTotal += actor.total();
+    }
+    test("memory usage of " + usage.name,
+      usage.usage.host > 0 && usage.usage.geometry > 0 && usage.usage.total() == actorsTotal);
+  }
+  eng.getOptions().scene.memory_budget = 0;
+  test("reload over the memory budget", [&]() { sce.reload(sphere2); });
+
+  // The memory budget is checked again once the point sprites are visible, only once
+  int budgetWarnings = 0;
+  f3d::log::forward(
+    [&](f3d::log::VerboseLevel, const std::string& message)
+    {
+      if (message.find("exceeds the memory budget") != std::string::npos)
+      {
+        budgetWarnings++;
+      }
+    });
+  eng.getOptions().model.point_sprites.type = "sphere";
+  win.render();
+  win.render();
+  f3d::log::forward(nullptr);
+  test("memory budget checked after showing point sprites", budgetWarnings == 1);
+  eng.getOptions().model.point_sprites.type = "none";
+  eng.getOptions().scene.memory_budget.reset();
+
+  // trace test
+  f3d::engine::setTracing(true);
+  sce.add(cube);
+  win.render();
+  f3d::engine::setTracing(false);
+  std::string trace = f3d::engine::getTrace();
+  test("trace contains the scene add", trace.find("\"name\":\"scene::add\"") != std::string::npos);
+  test("trace contains the importer",
+    trace.find("\"name\":\"import " + cubeFilename.substr(cubeFilename.rfind('/') + 1)) !=
+      std::string::npos);
+  test("trace contains the reader", trace.find("\"name\":\"read ") != std::string::npos);
+  test("trace contains the render", trace.find("\"name\":\"window::render\"") != std::string::npos);
+
   return test.result();
 }
@@ -0,0 +1,63 @@
+#include "PseudoUnitTest.h"
+
+#include <engine.h>
+#include <log.h>
+#include <options.h>
+#include <scene.h>
+#include <window.h>
+
+int TestSDKSceneDeferredArrays([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+{
+  PseudoUnitTest test;
+
+  // The debug description of the scene loads all the arrays
+  f3d::log::setVerboseLevel(f3d::log::VerboseLevel::INFO);
+
+  // clang-format off
+  try { f3d::engine::loadPlugin("hdf", {argv[3]}); } catch (...) {}
+  // clang-format on
+
+  f3d::engine eng = f3d::engine::create(true);
+  f3d::scene& sce = eng.getScene();
+  f3d::window& win = eng.getWindow().setSize(300, 300);
+  f3d::options& opt = eng.getOptions();
+
+  const auto getHostMemory = [&]()
+  {
+    std::vector<f3d::file_memory_usage_t> usages = sce.getMemoryUsage();
+    return usages.empty() ? 0 : usages[0].usage.host;
+  };
+
+  // Exodus arrays are not read until they are used for coloring
+  test("add exodus file", [&]() { sce.add(std::string(argv[1]) + "data/small.ex2"); });
+  win.render();
+  std::uint64_t deferredMemory = getHostMemory();
+  test("memory usage without arrays", deferredMemory > 0);
+
+  opt.model.scivis.enable = true;
+  opt.model.scivis.array_name = "VEL_";
+  win.render();
+  std::uint64_t coloringMemory = getHostMemory();
+  test("array read when used for coloring", coloringMemory > deferredMemory);
+
+  win.render();
+  test("array read only once", getHostMemory() == coloringMemory);
+
+  // Without an array name, only the array selected for coloring is read
+  opt.model.scivis.array_name.reset();
+  test("add exodus file again",
+    [&]() { sce.clear().add(std::string(argv[1]) + "data/small.ex2"); });
+  win.render();
+  std::uint64_t firstArrayMemory = getHostMemory();
+  test("first array read", firstArrayMemory > deferredMemory);
+
+  // Compare with all the arrays, read for the debug description
+  f3d::log::setVerboseLevel(f3d::log::VerboseLevel::DEBUG);
+  test("add exodus file with all arrays",
+    [&]() { sce.clear().add(std::string(argv[1]) + "data/small.ex2"); });
+  win.render();
+  f3d::log::setVerboseLevel(f3d::log::VerboseLevel::INFO);
+  test("other arrays not read", firstArrayMemory < getHostMemory());
+
+  return test.result();
+}
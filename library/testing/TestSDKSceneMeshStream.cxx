@@ -0,0 +1,130 @@
+#include "PseudoUnitTest.h"
+
+#include <camera.h>
+#include <engine.h>
+#include <interactor.h>
+#include <log.h>
+#include <mesh_stream.h>
+#include <scene.h>
+#include <window.h>
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// A triangle per buffer, moving along Z with each published state
+struct TriangleBuffers
+{
+  std::array<std::array<float, 9>, f3d::mesh_stream::BUFFER_COUNT> Positions;
+  std::array<uint32_t, 2> Offsets = { 0, 3 };
+  std::array<uint32_t, 3> Indices = { 0, 1, 2 };
+
+  f3d::mesh_view::memory_view_t Fill(size_t index, float z)
+  {
+    this->Positions[index] = { 0.f, 0.f, z, 1.f, 0.f, z, 0.5f, 1.f, z };
+
+    f3d::mesh_view::memory_view_t view;
+    view.pointCount = 3;
+    view.points = { .type = f3d::mesh_view::data_type::F32,
+      .data = this->Positions[index].data(),
+      .components = 3,
+      .stride = 3 };
+    view.polygons = { .offsetCount = 2,
+      .offsets = { .type = f3d::mesh_view::data_type::U32,
+        .data = this->Offsets.data(),
+        .timeDependent = false },
+      .indexCount = 3,
+      .indices = { .type = f3d::mesh_view::data_type::U32,
+        .data = this->Indices.data(),
+        .timeDependent = false } };
+    return view;
+  }
+};
+}
+
+int TestSDKSceneMeshStream([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+{
+  PseudoUnitTest test;
+
+  // Triple buffer logic, without any scene
+  {
+    TriangleBuffers buffers;
+    f3d::mesh_stream stream("stream");
+    test("nothing to acquire before publishing", !stream.acquire());
+
+    size_t first = stream.getWriteBufferIndex();
+    stream.publish(buffers.Fill(first, 1.f));
+    size_t second = stream.getWriteBufferIndex();
+    test("write buffer changes after publishing", first != second);
+    stream.publish(buffers.Fill(second, 2.f));
+
+    test("acquire newest state", stream.acquire());
+    test("intermediate state is skipped",
+      stream.getMemoryView(0).points.data == buffers.Positions[second].data());
+    test("nothing more to acquire", !stream.acquire());
+
+    size_t third = stream.getWriteBufferIndex();
+    test("acquired buffer is never written", third != second);
+    test("name", stream.getName(), std::string("stream"));
+  }
+
+  // Streaming from a producer thread while the event loop renders
+  f3d::engine eng = f3d::engine::create(true);
+  f3d::scene& sce = eng.getScene();
+  f3d::interactor& inter = eng.getInteractor();
+
+  TriangleBuffers buffers;
+  auto stream = std::make_shared<f3d::mesh_stream>();
+  stream->publish(buffers.Fill(stream->getWriteBufferIndex(), 0.f));
+  test("add streamed mesh", [&]() { sce.add(stream); });
+
+  std::atomic<bool> stop = false;
+  std::thread producer(
+    [&]()
+    {
+      float z = 0.f;
+      while (!stop)
+      {
+        z += 0.01f;
+        size_t index = stream->getWriteBufferIndex();
+        stream->publish(buffers.Fill(index, z));
+      }
+    });
+
+  test("update streamed mesh on event loop ticks",
+    [&]()
+    {
+      for (int i = 0; i < 20; i++)
+      {
+        inter.triggerEventLoop(1.0 / 30);
+      }
+    });
+
+  stop = true;
+  producer.join();
+
+  // The displayed mesh is the newest published one, the focal point is at the center of its bounds
+  f3d::camera& cam = eng.getWindow().getCamera();
+  const auto displayedZ = [&]()
+  {
+    cam.resetToBounds();
+    return cam.getFocalPoint()[2];
+  };
+
+  stream->publish(buffers.Fill(stream->getWriteBufferIndex(), 10.f));
+  inter.triggerEventLoop(1.0 / 30);
+  test("streamed mesh displayed after an event loop tick", std::abs(displayedZ() - 10.0) < 1e-6);
+
+  // Without any event loop, the newest state is picked up on render
+  stream->publish(buffers.Fill(stream->getWriteBufferIndex(), 20.f));
+  eng.getWindow().render();
+  test("streamed mesh displayed after a render", std::abs(displayedZ() - 20.0) < 1e-6);
+
+  test("clear streamed mesh", [&]() { sce.clear(); });
+
+  return test.result();
+}
@@ -0,0 +1,130 @@
+#include "PseudoUnitTest.h"
+
+#include <engine.h>
+#include <image.h>
+#include <log.h>
+#include <mesh_view.h>
+#include <options.h>
+#include <scene.h>
+#include <window.h>
+
+#include <array>
+
+namespace
+{
+constexpr std::array<unsigned int, 3> FaceOffsets = { 0, 3, 6 };
+constexpr std::array<unsigned int, 6> FaceIndices = { 0, 1, 2, 0, 2, 3 };
+
+// A static quad whose positions and scalars are tightly packed in separate arrays,
+// wrapped without any copy in contiguous arrays
+class ContiguousQuad : public f3d::mesh_view
+{
+public:
+  memory_view_t getMemoryView(double) const override
+  {
+    return { .pointCount = 4,
+      .points = { .data = this->Positions.data(),
+        .components = 3,
+        .stride = 3,
+        .timeDependent = false },
+      .polygons = { .offsetCount = FaceOffsets.size(),
+        .offsets = { .type = data_type::U32, .data = FaceOffsets.data() },
+        .indexCount = FaceIndices.size(),
+        .indices = { .type = data_type::U32, .data = FaceIndices.data() } },
+      .pointScalars = { { .name = "value",
+        .data = this->Values.data(),
+        .timeDependent = false } } };
+  }
+
+  // Move the third point inside the quad and change its value,
+  // the bounds and the scalar range used on load do not change
+  void Change()
+  {
+    this->Positions[6] = 0.5f;
+    this->Positions[7] = 0.5f;
+    this->Values[2] = 0.0f;
+  }
+
+  std::array<float, 12> Positions = { 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0 };
+  std::array<float, 4> Values = { 0, 1, 2, 3 };
+};
+
+// The same static quad with positions and scalars interleaved in a single array,
+// wrapped without any copy in strided arrays
+class InterleavedQuad : public f3d::mesh_view
+{
+public:
+  memory_view_t getMemoryView(double) const override
+  {
+    return { .pointCount = 4,
+      .points = { .data = this->Vertices.data(),
+        .components = 3,
+        .stride = 4,
+        .timeDependent = false },
+      .polygons = { .offsetCount = FaceOffsets.size(),
+        .offsets = { .type = data_type::U32, .data = FaceOffsets.data() },
+        .indexCount = FaceIndices.size(),
+        .indices = { .type = data_type::U32, .data = FaceIndices.data() } },
+      .pointScalars = { { .name = "value",
+        .data = this->Vertices.data() + 3,
+        .stride = 4,
+        .timeDependent = false } } };
+  }
+
+  // Move the third point and change its value, like ContiguousQuad::Change
+  void Change()
+  {
+    this->Vertices[8] = 0.5f;
+    this->Vertices[9] = 0.5f;
+    this->Vertices[11] = 0.0f;
+  }
+
+  std::array<float, 16> Vertices = { 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 0, 2, 0, 1, 0, 3 };
+};
+}
+
+int TestSDKSceneMeshViewLayouts([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::log::setVerboseLevel(f3d::log::VerboseLevel::DEBUG);
+  f3d::engine eng = f3d::engine::create(true);
+  f3d::scene& sce = eng.getScene();
+  f3d::window& win = eng.getWindow().setSize(300, 300);
+  eng.getOptions().model.scivis.enable = true;
+  eng.getOptions().model.scivis.array_name = "value";
+
+  // Reference images, with the quad changed before it is added
+  auto contiguous = std::make_shared<ContiguousQuad>();
+  test("add contiguous mesh view", [&]() { sce.add(contiguous); });
+  f3d::image contiguousImage = win.renderToImage();
+
+  auto changedContiguous = std::make_shared<ContiguousQuad>();
+  changedContiguous->Change();
+  test("clear the scene", [&]() { sce.clear(); });
+  test("add changed contiguous mesh view", [&]() { sce.add(changedContiguous); });
+  f3d::image changedImage = win.renderToImage();
+  test("changed mesh view displays differently", changedImage != contiguousImage);
+
+  // Static arrays are not queried again but read in place,
+  // a change made by the caller after the mesh view is added is displayed
+  auto mutatedContiguous = std::make_shared<ContiguousQuad>();
+  test("clear the scene", [&]() { sce.clear(); });
+  test("add contiguous mesh view to mutate", [&]() { sce.add(mutatedContiguous); });
+  mutatedContiguous->Change();
+  test("contiguous mesh view memory is not copied", win.renderToImage() == changedImage);
+
+  auto interleaved = std::make_shared<InterleavedQuad>();
+  test("clear the scene", [&]() { sce.clear(); });
+  test("add interleaved mesh view", [&]() { sce.add(interleaved); });
+  test("interleaved and contiguous layouts display the same",
+    win.renderToImage() == contiguousImage);
+
+  auto mutatedInterleaved = std::make_shared<InterleavedQuad>();
+  test("clear the scene", [&]() { sce.clear(); });
+  test("add interleaved mesh view to mutate", [&]() { sce.add(mutatedInterleaved); });
+  mutatedInterleaved->Change();
+  test("interleaved mesh view memory is not copied", win.renderToImage() == changedImage);
+
+  return test.result();
+}
@@ -27,5 +27,15 @@ int TestSDKWindowAuto([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
     TestSDKHelpers::RenderTest(
       win, std::string(argv[1]) + "baselines/", std::string(argv[2]), "TestSDKWindowStandard"));
 
+  // frames are only profiled with the fps counter, GPU timings may not be supported
+  test("no frame timings without fps", win.getFrameTimings().empty());
+  options.ui.fps = true;
+  for (int i = 0; i < 8; i++)
+  {
+    win.render();
+  }
+  std::vector<std::pair<std::string, double>> timings = win.getFrameTimings();
+  test("frame timings start with the frame", timings.empty() || timings.front().first == "frame");
+
   return test.result();
 }
@@ -2,6 +2,50 @@ void applyCustomReader(vtkAlgorithm* algo, const std::string&, vtkResourceStream
 {
   vtkExodusIIReader* exReader = vtkExodusIIReader::SafeDownCast(algo);
   exReader->UpdateInformation();
-  exReader->SetAllArrayStatus(vtkExodusIIReader::NODAL, 1);
-  exReader->SetAllArrayStatus(vtkExodusIIReader::ELEM_BLOCK, 1);
+
+  // Arrays are read on demand, when used for coloring, except for displacement arrays
+  // that are always needed to compute the geometry
+  vtkNew<vtkDataArraySelection> deferredArrays;
+  for (int type : { vtkExodusIIReader::NODAL, vtkExodusIIReader::ELEM_BLOCK })
+  {
+    int numArrays = exReader->GetNumberOfObjectArrays(type);
+    for (int i = 0; i < numArrays; i++)
+    {
+      const char* arrayName = exReader->GetObjectArrayName(type, i);
+      if (!arrayName)
+      {
+        continue;
+      }
+
+      bool displacement = type == vtkExodusIIReader::NODAL &&
+        vtksys::SystemTools::LowerCase(arrayName).rfind("dis", 0) == 0;
+      exReader->SetObjectArrayStatus(type, arrayName, displacement ? 1 : 0);
+      if (!displacement)
+      {
+        deferredArrays->AddArray(arrayName, false);
+      }
+    }
+  }
+
+  vtkNew<vtkCallbackCommand> deferredCallback;
+  deferredCallback->SetClientData(exReader);
+  deferredCallback->SetCallback(
+    [](vtkObject* caller, unsigned long, void* clientData, void*)
+    {
+      auto reader = static_cast<vtkExodusIIReader*>(clientData);
+      auto selection = static_cast<vtkDataArraySelection*>(caller);
+      for (int type : { vtkExodusIIReader::NODAL, vtkExodusIIReader::ELEM_BLOCK })
+      {
+        for (int i = 0; i < reader->GetNumberOfObjectArrays(type); i++)
+        {
+          const char* arrayName = reader->GetObjectArrayName(type, i);
+          if (arrayName && selection->ArrayExists(arrayName))
+          {
+            reader->SetObjectArrayStatus(type, arrayName, selection->ArrayIsEnabled(arrayName));
+          }
+        }
+      }
+    });
+  deferredArrays->AddObserver(vtkCommand::ModifiedEvent, deferredCallback);
+  exReader->GetInformation()->Set(vtkF3DImporter::READER_DEFERRED_ARRAYS(), deferredArrays);
 }
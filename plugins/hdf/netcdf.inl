@@ -2,14 +2,38 @@ void applyCustomReader(vtkAlgorithm* algo, const std::string&, vtkResourceStream
 {
   vtkNetCDFReader* ncReader = vtkNetCDFReader::SafeDownCast(algo);
   ncReader->UpdateInformation();
-  
+
+  // Only the first variable is read right away as it defines the output dimensions,
+  // other variables are read on demand, when used for coloring
+  vtkNew<vtkDataArraySelection> deferredArrays;
+  bool first = true;
   int numArrays = ncReader->GetNumberOfVariableArrays();
   for (int i = 0; i < numArrays; i++)
   {
     const char* arrayName = ncReader->GetVariableArrayName(i);
     if (arrayName)
     {
-      ncReader->SetVariableArrayStatus(arrayName, 1);
+      ncReader->SetVariableArrayStatus(arrayName, first ? 1 : 0);
+      if (!first)
+      {
+        deferredArrays->AddArray(arrayName, false);
+      }
+      first = false;
     }
   }
+
+  vtkNew<vtkCallbackCommand> deferredCallback;
+  deferredCallback->SetClientData(ncReader);
+  deferredCallback->SetCallback(
+    [](vtkObject* caller, unsigned long, void* clientData, void*)
+    {
+      auto reader = static_cast<vtkNetCDFReader*>(clientData);
+      auto selection = static_cast<vtkDataArraySelection*>(caller);
+      for (int i = 0; i < selection->GetNumberOfArrays(); i++)
+      {
+        reader->SetVariableArrayStatus(selection->GetArrayName(i), selection->GetArraySetting(i));
+      }
+    });
+  deferredArrays->AddObserver(vtkCommand::ModifiedEvent, deferredCallback);
+  ncReader->GetInformation()->Set(vtkF3DImporter::READER_DEFERRED_ARRAYS(), deferredArrays);
 }
@@ -1,5 +1,7 @@
 #include "vtkF3DOCCTReader.h"
 
+#include "vtkF3DImporter.h"
+
 #if defined(__GNUC__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Woverloaded-virtual"
@@ -63,8 +65,7 @@
 #include <vtkPolyData.h>
 #include <vtkResourceParser.h>
 #include <vtkResourceStream.h>
-#include <vtkTransform.h>
-#include <vtkTransformFilter.h>
+#include <vtkSMPTools.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkUnsignedIntArray.h>
 #include <vtksys/SystemTools.hxx>
@@ -78,11 +79,11 @@ vtkCxxSetSmartPointerMacro(vtkF3DOCCTReader, Stream, vtkResourceStream);
 
 class vtkF3DOCCTReader::vtkInternals
 {
+public:
 #if F3D_PLUGIN_OCCT_XCAF
   using StyleMap = NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>;
 #endif
 
-public:
   //----------------------------------------------------------------------------
   explicit vtkInternals(vtkF3DOCCTReader* parent)
     : Parent(parent)
@@ -90,10 +91,54 @@ public:
   }
 
   //----------------------------------------------------------------------------
+  /**
+   * Tessellate the faces, and the edges if wires are read, of the given shape.
+   * Triangulations are stored on the shared TShape, so this should be called once with all
+   * the unique shapes gathered in a compound to let OCCT mesh all faces in parallel.
+   * Normals are computed here as well so that CreateShape only reads the triangulations and
+   * can be called concurrently.
+   */
+  void MeshShape(const TopoDS_Shape& shape)
+  {
+    /* Mesh the whole shape. This only affect faces, edges have to be handled separately. */
+    BRepMesh_IncrementalMesh(shape, this->Parent->GetLinearDeflection(),
+      this->Parent->GetRelativeDeflection(), this->Parent->GetAngularDeflection(), true);
+
+    for (TopExp_Explorer exFace(shape, TopAbs_FACE); exFace.More(); exFace.Next())
+    {
+      TopLoc_Location location;
+      const auto& poly = BRep_Tool::Triangulation(TopoDS::Face(exFace.Current()), location);
+      if (!poly.IsNull() && !poly->HasNormals())
+      {
+        Poly::ComputeNormals(poly);
+      }
+    }
+
+    if (this->Parent->GetReadWire())
+    {
+      /* add all edges to a compound to remesh them all at once */
+      TopoDS_Builder builder;
+      TopoDS_Compound compound;
+      builder.MakeCompound(compound);
+      for (TopExp_Explorer exEdge(shape, TopAbs_EDGE); exEdge.More(); exEdge.Next())
+      {
+        builder.Add(compound, TopoDS::Edge(exEdge.Current()));
+      }
+      BRepMesh_IncrementalMesh(compound, this->Parent->GetLinearDeflection(),
+        this->Parent->GetRelativeDeflection(), this->Parent->GetAngularDeflection(), true);
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Convert a shape meshed with MeshShape to a polydata.
+   * This does not modify the shape and is safe to call from multiple threads.
+   */
 #if F3D_PLUGIN_OCCT_XCAF
-  vtkSmartPointer<vtkPolyData> CreateShape(const TopoDS_Shape& shape, const TDF_Label& label)
+  vtkSmartPointer<vtkPolyData> CreateShape(
+    const TopoDS_Shape& shape, const StyleMap& inheritedStyles) const
 #else
-  vtkSmartPointer<vtkPolyData> CreateShape(const TopoDS_Shape& shape)
+  vtkSmartPointer<vtkPolyData> CreateShape(const TopoDS_Shape& shape) const
 #endif
   {
     vtkNew<vtkPoints> points;
@@ -113,35 +158,12 @@ public:
 
     int shift = 0;
 
-#if F3D_PLUGIN_OCCT_XCAF
-    const StyleMap inheritedStyles = this->CollectInheritedStyles(label, shape);
-#endif
-
-    /* Mesh the whole shape. This only affect faces, edges have to be handled separately. */
-    BRepMesh_IncrementalMesh(shape, this->Parent->GetLinearDeflection(),
-      this->Parent->GetRelativeDeflection(), this->Parent->GetAngularDeflection(), true);
-
     if (this->Parent->GetReadWire())
     {
-      std::vector<TopoDS_Edge> edges;
-      {
-        /* add all edges to a compound to remesh them all at once */
-        TopoDS_Builder builder;
-        TopoDS_Compound compound;
-        builder.MakeCompound(compound);
-        for (TopExp_Explorer exEdge(shape, TopAbs_EDGE); exEdge.More(); exEdge.Next())
-        {
-          const TopoDS_Edge edge = TopoDS::Edge(exEdge.Current());
-          builder.Add(compound, edge);
-          edges.push_back(edge);
-        }
-        BRepMesh_IncrementalMesh(compound, this->Parent->GetLinearDeflection(),
-          this->Parent->GetRelativeDeflection(), this->Parent->GetAngularDeflection(), true);
-      }
-
       // Add all edges to polydata
-      for (const TopoDS_Edge& edge : edges)
+      for (TopExp_Explorer exEdge(shape, TopAbs_EDGE); exEdge.More(); exEdge.Next())
       {
+        const TopoDS_Edge edge = TopoDS::Edge(exEdge.Current());
         TopLoc_Location location;
         const auto& poly = BRep_Tool::Polygon3D(edge, location);
 
@@ -209,7 +231,6 @@ public:
         continue;
       }
 
-      Poly::ComputeNormals(poly);
       TopAbs_Orientation faceOrientation = face.Orientation();
 
       int nbT = poly->NbTriangles();
@@ -421,18 +442,13 @@ public:
       vtkPolyData* polydata = this->ShapeMap[this->GetHash(label)];
       if (polydata && polydata->GetNumberOfCells() > 0)
       {
-        vtkNew<vtkTransformFilter> transfoFilter;
-        vtkNew<vtkTransform> transfo;
-        transfo->SetMatrix(position);
-        transfoFilter->SetTransform(transfo);
-        transfoFilter->SetInputData(polydata);
-        transfoFilter->Update();
-
+        // Instances of a shape share its polydata, the location is applied on the actor
         vtkIdType blockId = mb->GetNumberOfBlocks();
-        mb->SetBlock(blockId, transfoFilter->GetOutput());
+        mb->SetBlock(blockId, polydata);
 
         vtkInformation* info = mb->GetMetaData(blockId);
         info->Set(vtkMultiBlockDataSet::NAME(), this->GetName(label));
+        info->Set(vtkF3DImporter::BLOCK_USER_MATRIX(), position->GetData(), 16);
       }
     }
     else
@@ -691,9 +707,10 @@ int vtkF3DOCCTReader::RequestData(
     if (success)
     {
       output->SetNumberOfBlocks(1);
+      this->Internals->MeshShape(shape);
 #if F3D_PLUGIN_OCCT_XCAF
       const vtkSmartPointer<vtkPolyData> polydata =
-        this->Internals->CreateShape(shape, TDF_Label());
+        this->Internals->CreateShape(shape, vtkInternals::StyleMap());
 #else
       const vtkSmartPointer<vtkPolyData> polydata = this->Internals->CreateShape(shape);
 #endif
@@ -769,20 +786,60 @@ int vtkF3DOCCTReader::RequestData(
   // create polydata leaves
   this->Internals->ShapeTool->GetShapes(topLevelShapes);
 
+  // Only simple shapes are converted, assemblies are built by instancing them in AddLabel
+  std::vector<TDF_Label> labels;
+  std::vector<TopoDS_Shape> shapes;
+  TopoDS_Builder builder;
+  TopoDS_Compound compound;
+  builder.MakeCompound(compound);
   for (int iLabel = 1; iLabel <= topLevelShapes.Length(); ++iLabel)
   {
     TDF_Label label = topLevelShapes.Value(iLabel);
+    if (!this->Internals->ShapeTool->IsSimpleShape(label))
+    {
+      continue;
+    }
 
     TopoDS_Shape shape;
     this->Internals->ShapeTool->GetShape(label, shape);
 
-    this->Internals->ShapeMap[this->Internals->GetHash(label)] =
-      this->Internals->CreateShape(shape, label);
+    labels.emplace_back(label);
+    shapes.emplace_back(shape);
+    builder.Add(compound, shape);
+  }
+
+  // Tessellate all unique shapes at once so that all their faces are meshed in parallel
+  this->Internals->MeshShape(compound);
+
+  double progress = 0.75;
+  this->InvokeEvent(vtkCommand::ProgressEvent, &progress);
+
+  // Styles are collected from the document first, then shapes are converted in parallel
+  std::vector<vtkInternals::StyleMap> styles;
+  styles.reserve(labels.size());
+  for (size_t i = 0; i < labels.size(); i++)
+  {
+    styles.emplace_back(this->Internals->CollectInheritedStyles(labels[i], shapes[i]));
+  }
+
+  std::vector<vtkSmartPointer<vtkPolyData>> polydatas(labels.size());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(labels.size()),
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        polydatas[i] = this->Internals->CreateShape(shapes[i], styles[i]);
+      }
+    });
 
-    double progress = 0.5 + (static_cast<double>(iLabel) / topLevelShapes.Length()) / 2;
-    this->InvokeEvent(vtkCommand::ProgressEvent, &progress);
+  for (size_t i = 0; i < labels.size(); i++)
+  {
+    this->Internals->ShapeMap[this->Internals->GetHash(labels[i])] = polydatas[i];
   }
 
+  progress = 1.0;
+  this->InvokeEvent(vtkCommand::ProgressEvent, &progress);
+
   // create multiblock
   this->Internals->ShapeTool->GetFreeShapes(topLevelShapes);
 
@@ -833,11 +890,31 @@ int vtkF3DOCCTReader::RequestData(
 
     output->SetNumberOfBlocks(nbShapes);
 
+    // Tessellate all shapes at once so that all their faces are meshed in parallel
+    std::vector<TopoDS_Shape> shapes;
+    TopoDS_Builder builder;
+    TopoDS_Compound compound;
+    builder.MakeCompound(compound);
     for (int iShape = 1; iShape <= nbShapes; iShape++)
     {
-      TopoDS_Shape shape = reader->Shape(iShape);
-      vtkSmartPointer<vtkPolyData> polydata = this->Internals->CreateShape(shape);
+      shapes.emplace_back(reader->Shape(iShape));
+      builder.Add(compound, shapes.back());
+    }
+    this->Internals->MeshShape(compound);
 
+    std::vector<vtkSmartPointer<vtkPolyData>> polydatas(nbShapes);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(nbShapes),
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          polydatas[i] = this->Internals->CreateShape(shapes[i]);
+        }
+      });
+
+    for (int iShape = 1; iShape <= nbShapes; iShape++)
+    {
+      const vtkSmartPointer<vtkPolyData>& polydata = polydatas[iShape - 1];
       if (polydata && polydata->GetNumberOfCells() > 0)
       {
         output->SetBlock(iShape, polydata);
@@ -19,6 +19,7 @@
 #include <vtkImageReader2Factory.h>
 #include <vtkImageResize.h>
 #include <vtkInformation.h>
+#include <vtkInformationDoubleVectorKey.h>
 #include <vtkInformationStringKey.h>
 #include <vtkMatrix4x4.h>
 #include <vtkObjectFactory.h>
@@ -246,7 +247,8 @@ public:
   void AddActor(vtkRenderer* renderer, vtkDataAssembly* hierarchy,
     vtkActorCollection* actorCollection, const pxr::SdfPath& path,
     const pxr::UsdGeomGprim& geomPrim, const pxr::UsdPrim& prim, vtkMatrix4x4* mat,
-    vtkPolyData* polydata, bool useDirectScalars = false)
+    vtkPolyData* polydata, bool useDirectScalars = false,
+    const std::vector<double>& instanceMatrices = {})
   {
     pxr::SdfPath actorPath = path.AppendChild(pxr::TfToken(prim.GetName()));
 
@@ -375,13 +377,41 @@ public:
       mapper->StaticOn();
     }
 
+    if (!instanceMatrices.empty())
+    {
+      mapper->GetInformation()->Set(vtkF3DImporter::MAPPER_INSTANCE_MATRICES(),
+        instanceMatrices.data(), static_cast<int>(instanceMatrices.size()));
+    }
+
     actor->SetMapper(mapper);
     actor->SetUserMatrix(mat);
   }
 
+  /**
+   * Compose the instances matrices with the given local matrix, in the row-major layout
+   * expected by vtkF3DImporter::MAPPER_INSTANCE_MATRICES
+   */
+  static std::vector<double> ComposeInstanceMatrices(
+    const std::vector<vtkSmartPointer<vtkMatrix4x4>>& instances, vtkMatrix4x4* local)
+  {
+    std::vector<double> matrices(16 * instances.size());
+    for (size_t i = 0; i < instances.size(); i++)
+    {
+      vtkMatrix4x4::Multiply4x4(
+        instances[i]->GetData(), local->GetData(), matrices.data() + 16 * i);
+    }
+    return matrices;
+  }
+
+  /**
+   * Import the children of the given node.
+   * If instances is not empty, the imported geometries are drawn once per instance,
+   * each instance matrix being applied before the local transform of the geometry
+   * and after currentMatrix.
+   */
   void ImportNode(vtkRenderer* renderer, vtkDataAssembly* hierarchy,
     vtkActorCollection* actorCollection, const pxr::UsdPrim& node, const pxr::SdfPath& path,
-    vtkMatrix4x4* currentMatrix)
+    vtkMatrix4x4* currentMatrix, const std::vector<vtkSmartPointer<vtkMatrix4x4>>& instances = {})
   {
     pxr::UsdTimeCode timeCode = this->CurrentTime * this->Stage->GetTimeCodesPerSecond();
 
@@ -416,32 +446,58 @@ public:
         pxr::UsdGeomXform xform = pxr::UsdGeomXform(prim);
 
         auto mat = this->GetLocalTransform(xform, timeCode);
-        vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
 
-        this->ImportNode(renderer, hierarchy, actorCollection, prim.GetPrototype(),
-          path.AppendChild(prim.GetName()), mat);
+        if (instances.empty())
+        {
+          vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
+
+          this->ImportNode(renderer, hierarchy, actorCollection, prim.GetPrototype(),
+            path.AppendChild(prim.GetName()), mat);
+        }
+        else
+        {
+          // apply the transform to each instance
+          std::vector<vtkSmartPointer<vtkMatrix4x4>> prototypeInstances;
+          for (const vtkSmartPointer<vtkMatrix4x4>& instance : instances)
+          {
+            vtkNew<vtkMatrix4x4> instanceMat;
+            vtkMatrix4x4::Multiply4x4(instance, mat, instanceMat);
+            prototypeInstances.emplace_back(instanceMat);
+          }
+
+          this->ImportNode(renderer, hierarchy, actorCollection, prim.GetPrototype(),
+            path.AppendChild(prim.GetName()), currentMatrix, prototypeInstances);
+        }
       }
       else if (prim.IsA<pxr::UsdGeomPointInstancer>())
       {
         pxr::UsdGeomPointInstancer glyphs = pxr::UsdGeomPointInstancer(prim);
 
-        // TODO: Ideally, we should use the 3D glyph mapper, but it's left for future work
-        // See https://github.com/f3d-app/f3d/issues/1075
         pxr::VtMatrix4dArray xforms;
 
-        if (glyphs.ComputeInstanceTransformsAtTime(&xforms, timeCode, timeCode))
+        if (glyphs.ComputeInstanceTransformsAtTime(&xforms, timeCode, timeCode) && !xforms.empty())
         {
-          int i = 0;
+          // prototypes are imported once and drawn for all instances, nested instancers
+          // result in the cartesian product of the instances
+          std::vector<vtkSmartPointer<vtkMatrix4x4>> glyphInstances;
+          glyphInstances.reserve(xforms.size() * std::max<size_t>(instances.size(), 1));
           for (const pxr::GfMatrix4d& currInstMatrix : xforms)
           {
             auto mat = this->ConvertMatrix(currInstMatrix);
-            vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
-
-            pxr::TfToken tok(std::string("instance_") + std::to_string(i++));
-
-            this->ImportNode(renderer, hierarchy, actorCollection, prim,
-              path.AppendChild(prim.GetName()).AppendChild(tok), mat);
+            if (instances.empty())
+            {
+              glyphInstances.emplace_back(mat);
+            }
+            for (const vtkSmartPointer<vtkMatrix4x4>& instance : instances)
+            {
+              vtkNew<vtkMatrix4x4> instanceMat;
+              vtkMatrix4x4::Multiply4x4(instance, mat, instanceMat);
+              glyphInstances.emplace_back(instanceMat);
+            }
           }
+
+          this->ImportNode(renderer, hierarchy, actorCollection, prim,
+            path.AppendChild(prim.GetName()), currentMatrix, glyphInstances);
         }
       }
       else if (prim.IsA<pxr::UsdGeomGprim>())
@@ -694,20 +750,58 @@ public:
               {
                 MorphingInfo& info = this->MorphingMap[meshPrim.GetPath().GetAsString()];
 
-                // Cache blend shape data for per-frame CPU deformation
-                info.BindPositions = positions;
                 pxr::UsdSkelBindingAPI binding(prim);
                 pxr::UsdSkelBlendShapeQuery blendShapeQuery(binding);
                 if (blendShapeQuery)
                 {
                   info.BlendShapePointIndices = blendShapeQuery.ComputeBlendShapePointIndices();
                   info.SubShapePointOffsets = blendShapeQuery.ComputeSubShapePointOffsets();
+
+                  // F3D mapper supports up to 4 morph targets without in-betweens, in which case
+                  // offsets are stored as dense point arrays and deformation happens on the GPU
+                  std::size_t numBlendShapes = blendShapeQuery.GetNumBlendShapes();
+                  info.UseGPU = numBlendShapes <= 4 &&
+                    blendShapeQuery.GetNumSubShapes() == numBlendShapes &&
+                    info.SubShapePointOffsets.size() == numBlendShapes &&
+                    info.BlendShapePointIndices.size() == numBlendShapes;
+
+                  for (std::size_t i = 0; info.UseGPU && i < numBlendShapes; i++)
+                  {
+                    const pxr::VtIntArray& pointIndices = info.BlendShapePointIndices[i];
+                    const pxr::VtVec3fArray& offsets = info.SubShapePointOffsets[i];
+
+                    vtkNew<vtkFloatArray> target;
+                    target->SetName(("target" + std::to_string(i) + "_position").c_str());
+                    target->SetNumberOfComponents(3);
+                    target->SetNumberOfTuples(static_cast<vtkIdType>(positions.size()));
+                    target->Fill(0);
+
+                    for (std::size_t j = 0; j < offsets.size(); j++)
+                    {
+                      // empty point indices means offsets are provided for all points
+                      std::size_t idx =
+                        pointIndices.empty() ? j : static_cast<std::size_t>(pointIndices[j]);
+                      if (idx < positions.size())
+                      {
+                        target->SetTypedTuple(static_cast<vtkIdType>(idx), offsets[j].data());
+                      }
+                    }
+                    newPolyData->GetPointData()->AddArray(target);
+                  }
+                }
+
+                if (!info.UseGPU)
+                {
+                  // Cache blend shape data for per-frame CPU deformation
+                  info.BindPositions = positions;
                 }
               }
             }
 
+            // Points are only remapped using SourceIds when animated, so corners can be welded
             vtkNew<vtkF3DFaceVaryingPointDispatcher> faceVaryingFilter;
             faceVaryingFilter->SetInputData(newPolyData);
+            faceVaryingFilter->WeldOn();
             faceVaryingFilter->Update();
 
             mappedPolydata = faceVaryingFilter->GetOutput();
@@ -958,16 +1052,25 @@ public:
 
         // create actors
 
-        // get xform
+        // get xform, when instanced the local transform is applied to each instance
         auto mat = this->GetLocalTransform(geomPrim, timeCode);
-        vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
+        std::vector<double> instanceMatrices;
+        if (instances.empty())
+        {
+          vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
+        }
+        else
+        {
+          instanceMatrices = vtkInternals::ComposeInstanceMatrices(instances, mat);
+          mat->DeepCopy(currentMatrix);
+        }
 
         std::vector<pxr::UsdGeomSubset> subsets = pxr::UsdGeomSubset::GetGeomSubsets(geomPrim);
 
         if (subsets.empty())
         {
           this->AddActor(renderer, hierarchy, actorCollection, path, geomPrim, prim, mat, polydata,
-            useDirectScalars);
+            useDirectScalars, instanceMatrices);
         }
         else
         {
@@ -999,7 +1102,7 @@ public:
 
             this->AddActor(renderer, hierarchy, actorCollection,
               path.AppendChild(pxr::TfToken(prim.GetName())), geomPrim, subset.GetPrim(), mat,
-              polydataSubset);
+              polydataSubset, false, instanceMatrices);
           }
         }
       }
@@ -1010,7 +1113,8 @@ public:
         this->GetOrCreateHierarchyNode(hierarchy, nodePath, prim.GetName().GetString());
 
         // just traverse the node
-        this->ImportNode(renderer, hierarchy, actorCollection, prim, nodePath, currentMatrix);
+        this->ImportNode(
+          renderer, hierarchy, actorCollection, prim, nodePath, currentMatrix, instances);
       }
     }
   }
@@ -1181,7 +1285,8 @@ public:
                 "jointMatrices", static_cast<int>(skinningXforms.size()), jointMatrices.data());
             }
 
-            // Morphing: compute blend shape deformations and update points
+            // Morphing: update shader morph weights or compute blend shape deformations and
+            // update points
             pxr::VtFloatArray allWeights;
             const pxr::UsdSkelAnimQuery& animQuery = skelQuery.GetAnimQuery();
             if (!animQuery || !animQuery.ComputeBlendShapeWeights(&allWeights, timeCode))
@@ -1199,6 +1304,23 @@ public:
               allWeights = remapped;
             }
 
+            const auto& morphInfo = this->MorphingMap[primPath];
+
+            if (morphInfo.UseGPU)
+            {
+              // Without in-betweens, each blend shape weight drives its morph target directly
+              std::size_t numTargets = morphInfo.SubShapePointOffsets.size();
+              if (numTargets > 0)
+              {
+                std::vector<float> morphWeights(numTargets, 0.f);
+                std::copy_n(allWeights.cbegin(), std::min(numTargets, allWeights.size()),
+                  morphWeights.begin());
+                uniforms->SetUniform1fv(
+                  "morphWeights", static_cast<int>(numTargets), morphWeights.data());
+              }
+              continue;
+            }
+
             pxr::UsdSkelBindingAPI bindingAPI(skinTarget.GetPrim());
             pxr::UsdSkelBlendShapeQuery blendShapeQuery(bindingAPI);
 
@@ -1207,8 +1329,6 @@ public:
             blendShapeQuery.ComputeSubShapeWeights(
               allWeights, &subShapeWeights, &blendShapeIndices, &subShapeIndices);
 
-            const auto& morphInfo = this->MorphingMap[primPath];
-
             // Execute CPU-side morphing
             pxr::VtArray<pxr::GfVec3f> positions = morphInfo.BindPositions;
             blendShapeQuery.ComputeDeformedPoints(subShapeWeights, blendShapeIndices,
@@ -1739,6 +1859,7 @@ public:
 private:
   struct MorphingInfo
   {
+    bool UseGPU = false;
     pxr::VtArray<pxr::GfVec3f> BindPositions;
     std::vector<pxr::VtIntArray> BlendShapePointIndices;
     std::vector<pxr::VtVec3fArray> SubShapePointOffsets;
@@ -2,8 +2,9 @@
 
 #include <vtkCellArray.h>
 #include <vtkCellData.h>
-#include <vtkDoubleArray.h>
 #include <vtkFileResourceStream.h>
+#include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
 #include <vtkInformation.h>
 #include <vtkNew.h>
 #include <vtkObjectFactory.h>
@@ -12,6 +13,7 @@
 #include <vtkPolyData.h>
 #include <vtkResourceParser.h>
 #include <vtkResourceStream.h>
+#include <vtkSMPTools.h>
 #include <vtkUnsignedCharArray.h>
 
 #include <web-ifc/modelmanager/ModelManager.h>
@@ -161,14 +163,21 @@ int vtkF3DWebIFCReader::RequestData(
     const webifc::schema::IfcSchemaManager& schemaManager =
       this->Internals->Manager.GetSchemaManager();
 
-    vtkNew<vtkPoints> allPoints;
-    vtkNew<vtkCellArray> allPolys;
-    vtkNew<vtkDoubleArray> normals;
-    normals->SetNumberOfComponents(3);
-    normals->SetName("Normals");
-    vtkNew<vtkUnsignedCharArray> colors;
-    colors->SetNumberOfComponents(4);
-    colors->SetName("Colors");
+    // First phase, serial as web-ifc geometry processing is not thread safe:
+    // extract the geometries of all elements and compute their offsets in the output arrays
+    struct PlacedGeometry
+    {
+      const webifc::geometry::IfcGeometry* Geometry;
+      std::array<double, 16> Transform;
+      std::array<unsigned char, 4> Color;
+      vtkIdType PointOffset;
+      vtkIdType CellOffset;
+    };
+    std::vector<PlacedGeometry> placedGeometries;
+
+    constexpr size_t vertexSize = 6;
+    vtkIdType nbPoints = 0;
+    vtkIdType nbCells = 0;
 
     auto processElement = [&](uint32_t expressID)
     {
@@ -178,121 +187,24 @@ int vtkF3DWebIFCReader::RequestData(
       {
         const auto& geometry = geometryProcessor->GetGeometry(placedGeom.geometryExpressID);
 
-        const auto& vertexData = geometry.vertexData;
-        const auto& indexData = geometry.indexData;
-
-        if (vertexData.empty() || indexData.empty())
+        if (geometry.vertexData.empty() || geometry.indexData.empty())
         {
           continue;
         }
 
-        const auto& transform = placedGeom.flatTransformation;
-        std::array<unsigned char, 4> color = { static_cast<unsigned char>(placedGeom.color.r * 255),
+        PlacedGeometry& placed = placedGeometries.emplace_back();
+        placed.Geometry = &geometry;
+        std::copy(placedGeom.flatTransformation.begin(), placedGeom.flatTransformation.end(),
+          placed.Transform.begin());
+        placed.Color = { static_cast<unsigned char>(placedGeom.color.r * 255),
           static_cast<unsigned char>(placedGeom.color.g * 255),
           static_cast<unsigned char>(placedGeom.color.b * 255),
           static_cast<unsigned char>(placedGeom.color.a * 255) };
+        placed.PointOffset = nbPoints;
+        placed.CellOffset = nbCells;
 
-        vtkIdType pointOffset = allPoints->GetNumberOfPoints();
-        constexpr int vertexSize = 6;
-
-#ifdef __linux__
-        // WORKAROUND: web-ifc produces inconsistent triangle winding order on Linux.
-        // Vertex normals are correct, so compare with geometric normal to fix winding.
-        // Once https://github.com/ThatOpen/engine_web-ifc/issues/1811 is fixed,
-        // remove this #ifdef __linux__ block and keep only the #else branch.
-        std::vector<std::array<double, 3>> localPositions;
-        std::vector<std::array<double, 3>> localNormals;
-        localPositions.reserve(vertexData.size() / vertexSize);
-        localNormals.reserve(vertexData.size() / vertexSize);
-
-        for (size_t i = 0; i < vertexData.size(); i += vertexSize)
-        {
-          double x = vertexData[i];
-          double y = vertexData[i + 1];
-          double z = vertexData[i + 2];
-          double nx = vertexData[i + 3];
-          double ny = vertexData[i + 4];
-          double nz = vertexData[i + 5];
-
-          double tx = transform[0] * x + transform[4] * y + transform[8] * z + transform[12];
-          double ty = transform[1] * x + transform[5] * y + transform[9] * z + transform[13];
-          double tz = transform[2] * x + transform[6] * y + transform[10] * z + transform[14];
-
-          double tnx = transform[0] * nx + transform[4] * ny + transform[8] * nz;
-          double tny = transform[1] * nx + transform[5] * ny + transform[9] * nz;
-          double tnz = transform[2] * nx + transform[6] * ny + transform[10] * nz;
-
-          localPositions.push_back({ tx, ty, tz });
-          localNormals.push_back({ tnx, tny, tnz });
-          allPoints->InsertNextPoint(tx, ty, tz);
-          normals->InsertNextTuple3(tnx, tny, tnz);
-        }
-
-        for (size_t i = 0; i < indexData.size(); i += 3)
-        {
-          uint32_t i0 = indexData[i];
-          uint32_t i1 = indexData[i + 1];
-          uint32_t i2 = indexData[i + 2];
-
-          const auto& p0 = localPositions[i0];
-          const auto& p1 = localPositions[i1];
-          const auto& p2 = localPositions[i2];
-
-          double e1x = p1[0] - p0[0], e1y = p1[1] - p0[1], e1z = p1[2] - p0[2];
-          double e2x = p2[0] - p0[0], e2y = p2[1] - p0[1], e2z = p2[2] - p0[2];
-          double gnx = e1y * e2z - e1z * e2y;
-          double gny = e1z * e2x - e1x * e2z;
-          double gnz = e1x * e2y - e1y * e2x;
-
-          const auto& n0 = localNormals[i0];
-          const auto& n1 = localNormals[i1];
-          const auto& n2 = localNormals[i2];
-          double avgNx = n0[0] + n1[0] + n2[0];
-          double avgNy = n0[1] + n1[1] + n2[1];
-          double avgNz = n0[2] + n1[2] + n2[2];
-
-          bool windingIsWrong = (gnx * avgNx + gny * avgNy + gnz * avgNz) < 0;
-          if (windingIsWrong)
-          {
-            std::swap(i1, i2);
-          }
-
-          vtkIdType pts[3] = { static_cast<vtkIdType>(i0) + pointOffset,
-            static_cast<vtkIdType>(i1) + pointOffset, static_cast<vtkIdType>(i2) + pointOffset };
-          allPolys->InsertNextCell(3, pts);
-          colors->InsertNextTypedTuple(color.data());
-        }
-#else
-        for (size_t i = 0; i < vertexData.size(); i += vertexSize)
-        {
-          double x = vertexData[i];
-          double y = vertexData[i + 1];
-          double z = vertexData[i + 2];
-          double nx = vertexData[i + 3];
-          double ny = vertexData[i + 4];
-          double nz = vertexData[i + 5];
-
-          double tx = transform[0] * x + transform[4] * y + transform[8] * z + transform[12];
-          double ty = transform[1] * x + transform[5] * y + transform[9] * z + transform[13];
-          double tz = transform[2] * x + transform[6] * y + transform[10] * z + transform[14];
-
-          double tnx = transform[0] * nx + transform[4] * ny + transform[8] * nz;
-          double tny = transform[1] * nx + transform[5] * ny + transform[9] * nz;
-          double tnz = transform[2] * nx + transform[6] * ny + transform[10] * nz;
-
-          allPoints->InsertNextPoint(tx, ty, tz);
-          normals->InsertNextTuple3(tnx, tny, tnz);
-        }
-
-        for (size_t i = 0; i < indexData.size(); i += 3)
-        {
-          vtkIdType pts[3] = { static_cast<vtkIdType>(indexData[i]) + pointOffset,
-            static_cast<vtkIdType>(indexData[i + 1]) + pointOffset,
-            static_cast<vtkIdType>(indexData[i + 2]) + pointOffset };
-          allPolys->InsertNextCell(3, pts);
-          colors->InsertNextTypedTuple(color.data());
-        }
-#endif
+        nbPoints += static_cast<vtkIdType>(geometry.vertexData.size() / vertexSize);
+        nbCells += static_cast<vtkIdType>(geometry.indexData.size() / 3);
       }
     };
 
@@ -318,6 +230,116 @@ int vtkF3DWebIFCReader::RequestData(
       }
     }
 
+    // Second phase, all arrays are allocated once and each geometry is written in parallel
+    // at its own offset
+    vtkNew<vtkFloatArray> positions;
+    positions->SetNumberOfComponents(3);
+    positions->SetNumberOfTuples(nbPoints);
+    vtkNew<vtkFloatArray> normals;
+    normals->SetNumberOfComponents(3);
+    normals->SetNumberOfTuples(nbPoints);
+    normals->SetName("Normals");
+    vtkNew<vtkIdTypeArray> offsets;
+    offsets->SetNumberOfTuples(nbCells + 1);
+    vtkNew<vtkIdTypeArray> connectivity;
+    connectivity->SetNumberOfTuples(3 * nbCells);
+    vtkNew<vtkUnsignedCharArray> colors;
+    colors->SetNumberOfComponents(4);
+    colors->SetNumberOfTuples(nbCells);
+    colors->SetName("Colors");
+
+    float* positionsPtr = positions->GetPointer(0);
+    float* normalsPtr = normals->GetPointer(0);
+    vtkIdType* offsetsPtr = offsets->GetPointer(0);
+    vtkIdType* connectivityPtr = connectivity->GetPointer(0);
+    unsigned char* colorsPtr = colors->GetPointer(0);
+
+    vtkSMPTools::For(0, static_cast<vtkIdType>(placedGeometries.size()),
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType g = begin; g < end; g++)
+        {
+          const PlacedGeometry& placed = placedGeometries[g];
+          const auto& vertexData = placed.Geometry->vertexData;
+          const auto& indexData = placed.Geometry->indexData;
+          const std::array<double, 16>& transform = placed.Transform;
+
+          float* pos = positionsPtr + 3 * placed.PointOffset;
+          float* nor = normalsPtr + 3 * placed.PointOffset;
+          for (size_t i = 0; i < vertexData.size(); i += vertexSize)
+          {
+            double x = vertexData[i];
+            double y = vertexData[i + 1];
+            double z = vertexData[i + 2];
+            double nx = vertexData[i + 3];
+            double ny = vertexData[i + 4];
+            double nz = vertexData[i + 5];
+
+            *pos++ = static_cast<float>(
+              transform[0] * x + transform[4] * y + transform[8] * z + transform[12]);
+            *pos++ = static_cast<float>(
+              transform[1] * x + transform[5] * y + transform[9] * z + transform[13]);
+            *pos++ = static_cast<float>(
+              transform[2] * x + transform[6] * y + transform[10] * z + transform[14]);
+
+            *nor++ = static_cast<float>(transform[0] * nx + transform[4] * ny + transform[8] * nz);
+            *nor++ = static_cast<float>(transform[1] * nx + transform[5] * ny + transform[9] * nz);
+            *nor++ = static_cast<float>(transform[2] * nx + transform[6] * ny + transform[10] * nz);
+          }
+
+          vtkIdType cellId = placed.CellOffset;
+          for (size_t i = 0; i < indexData.size(); i += 3, cellId++)
+          {
+            uint32_t i0 = indexData[i];
+            uint32_t i1 = indexData[i + 1];
+            uint32_t i2 = indexData[i + 2];
+
+#ifdef __linux__
+            // WORKAROUND: web-ifc produces inconsistent triangle winding order on Linux.
+            // Vertex normals are correct, so compare with geometric normal to fix winding.
+            // Once https://github.com/ThatOpen/engine_web-ifc/issues/1811 is fixed,
+            // remove this #ifdef __linux__ block.
+            // The check is done on the untransformed double precision vertex data, as the
+            // float world positions lose precision for small triangles far from the origin.
+            const double* p0 = vertexData.data() + vertexSize * i0;
+            const double* p1 = vertexData.data() + vertexSize * i1;
+            const double* p2 = vertexData.data() + vertexSize * i2;
+
+            double e1x = p1[0] - p0[0], e1y = p1[1] - p0[1], e1z = p1[2] - p0[2];
+            double e2x = p2[0] - p0[0], e2y = p2[1] - p0[1], e2z = p2[2] - p0[2];
+            double gnx = e1y * e2z - e1z * e2y;
+            double gny = e1z * e2x - e1x * e2z;
+            double gnz = e1x * e2y - e1y * e2x;
+
+            const double* n0 = p0 + 3;
+            const double* n1 = p1 + 3;
+            const double* n2 = p2 + 3;
+            double avgNx = n0[0] + n1[0] + n2[0];
+            double avgNy = n0[1] + n1[1] + n2[1];
+            double avgNz = n0[2] + n1[2] + n2[2];
+
+            bool windingIsWrong = (gnx * avgNx + gny * avgNy + gnz * avgNz) < 0;
+            if (windingIsWrong)
+            {
+              std::swap(i1, i2);
+            }
+#endif
+
+            offsetsPtr[cellId] = 3 * cellId;
+            connectivityPtr[3 * cellId] = static_cast<vtkIdType>(i0) + placed.PointOffset;
+            connectivityPtr[3 * cellId + 1] = static_cast<vtkIdType>(i1) + placed.PointOffset;
+            connectivityPtr[3 * cellId + 2] = static_cast<vtkIdType>(i2) + placed.PointOffset;
+            std::copy(placed.Color.begin(), placed.Color.end(), colorsPtr + 4 * cellId);
+          }
+        }
+      });
+    offsetsPtr[nbCells] = 3 * nbCells;
+
+    vtkNew<vtkPoints> allPoints;
+    allPoints->SetData(positions);
+    vtkNew<vtkCellArray> allPolys;
+    allPolys->SetData(offsets, connectivity);
+
     output->SetPoints(allPoints);
     output->SetPolys(allPolys);
     output->GetPointData()->SetNormals(normals);
@@ -201,6 +201,8 @@ PYBIND11_MODULE(pyf3d, module)
     .def_property_readonly("channel_type_size", &f3d::image::getChannelTypeSize)
     .def_property("content", getImageBytes, setImageBytes)
     .def("compare", &f3d::image::compare)
+    .def("compare_tiles", &f3d::image::compareTiles, py::arg("reference"),
+      py::arg("tile_size") = 64)
     .def(
       "save", &f3d::image::save, py::arg("path"), py::arg("format") = f3d::image::SaveFormat::PNG)
     .def("save_buffer", getFileBytes, py::arg("format") = f3d::image::SaveFormat::PNG)
@@ -402,7 +404,8 @@ PYBIND11_MODULE(pyf3d, module)
       "Trigger a text character input")
     .def(
       "trigger_event_loop", &f3d::interactor::triggerEventLoop, "Manually trigger the event loop.")
-    .def("play_interaction", &f3d::interactor::playInteraction, "Play an interaction file")
+    .def("play_interaction", &f3d::interactor::playInteraction, "Play an interaction file",
+      py::arg("file"), py::arg("delta_time") = 1.0 / 30, py::arg("checkpoints_only") = false)
     .def("record_interaction", &f3d::interactor::recordInteraction, "Record an interaction file")
     .def("start", &f3d::interactor::start, "Start the interactor and the event loop",
       py::arg("delta_time") = 1.0 / 30)
@@ -728,11 +731,29 @@ PYBIND11_MODULE(pyf3d, module)
     .def_readwrite("intensity", &f3d::light_state_t::intensity)
     .def_readwrite("switch_state", &f3d::light_state_t::switchState);
 
+  // f3d::memory_usage_t
+  py::class_<f3d::memory_usage_t>(module, "MemoryUsage")
+    .def(py::init<>())
+    .def_readwrite("host", &f3d::memory_usage_t::host)
+    .def_readwrite("geometry", &f3d::memory_usage_t::geometry)
+    .def_readwrite("textures", &f3d::memory_usage_t::textures)
+    .def_readwrite("auxiliary", &f3d::memory_usage_t::auxiliary)
+    .def("total", &f3d::memory_usage_t::total, "Sum of all memory usages, in bytes");
+
+  // f3d::file_memory_usage_t
+  py::class_<f3d::file_memory_usage_t>(module, "FileMemoryUsage")
+    .def(py::init<>())
+    .def_readwrite("name", &f3d::file_memory_usage_t::name)
+    .def_readwrite("usage", &f3d::file_memory_usage_t::usage)
+    .def_readwrite("actors", &f3d::file_memory_usage_t::actors);
+
   // f3d::scene
   py::class_<f3d::scene, std::unique_ptr<f3d::scene, py::nodelete>> scene(module, "Scene");
   scene //
     .def("supports", &f3d::scene::supports)
     .def("clear", &f3d::scene::clear)
+    .def("reload", &f3d::scene::reload, "Reload a file previously added to the scene",
+      py::arg("file_path"))
     .def("add", py::overload_cast<const std::filesystem::path&>(&f3d::scene::add),
       "Add a file the scene", py::arg("file_path"))
     .def("add", py::overload_cast<const std::vector<std::filesystem::path>&>(&f3d::scene::add),
@@ -775,7 +796,9 @@ PYBIND11_MODULE(pyf3d, module)
       py::arg("light_state"))
     .def("get_light", &f3d::scene::getLight, "Get a light from the scene", py::arg("index"))
     .def("get_light_count", &f3d::scene::getLightCount, "Get the number of lights in the scene")
-    .def("remove_all_lights", &f3d::scene::removeAllLights, "Remove all lights from the scene");
+    .def("remove_all_lights", &f3d::scene::removeAllLights, "Remove all lights from the scene")
+    .def("get_memory_usage", &f3d::scene::getMemoryUsage,
+      "Get the memory used by each file added to the scene and by their actors");
 
   // f3d::camera_state_t
   py::class_<f3d::camera_state_t>(module, "CameraState")
@@ -852,7 +875,9 @@ PYBIND11_MODULE(pyf3d, module)
     .def("get_world_from_display", &f3d::window::getWorldFromDisplay,
       "Get world coordinate point from display coordinate")
     .def("get_display_from_world", &f3d::window::getDisplayFromWorld,
-      "Get display coordinate point from world coordinate");
+      "Get display coordinate point from world coordinate")
+    .def("get_frame_timings", &f3d::window::getFrameTimings,
+      "Get the GPU time in seconds of the stages of the frame read back during the latest render");
 
   // libInformation
   py::class_<f3d::engine::libInformation>(module, "LibInformation")
@@ -941,7 +966,11 @@ PYBIND11_MODULE(pyf3d, module)
           throw py::key_error(name);
         }
       })
-    .def_static("get_all_reader_option_names", &f3d::engine::getAllReaderOptionNames);
+    .def_static("get_all_reader_option_names", &f3d::engine::getAllReaderOptionNames)
+    .def_static("set_tracing", &f3d::engine::setTracing,
+      "Start or stop recording a trace of the loading and rendering stages", py::arg("enable"))
+    .def_static("get_trace", &f3d::engine::getTrace,
+      "Get the recorded trace in the Chrome trace event JSON format");
 
   // f3d::log
   py::class_<f3d::log> log(module, "Log");
@@ -23,3 +23,9 @@ def test_compare_with_file():
     img.save(output)
 
     assert img.compare(f3d.Image(reference)) <= 0.05
+
+
+def test_compare_tiles():
+    img = f3d.Image(32, 32, 3)
+    assert img.compare(img) == 0
+    assert img.compare_tiles(img, 16) == [0, 0, 0, 0]
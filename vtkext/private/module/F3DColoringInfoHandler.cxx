@@ -15,6 +15,9 @@ void F3DColoringInfoHandler::ClearColoringInfo()
 {
   this->PointDataColoringInfo.clear();
   this->CellDataColoringInfo.clear();
+
+  // The current coloring points into the cleared maps, it must be set again
+  this->CurrentColoringIter.reset();
 }
 
 //----------------------------------------------------------------------------
@@ -185,3 +188,16 @@ void F3DColoringInfoHandler::CycleColoringArray(bool cycleToNonColoring)
     }
   }
 }
+
+//----------------------------------------------------------------------------
+std::optional<std::string> F3DColoringInfoHandler::GetArrayNameAfter(
+  bool useCellData, const std::optional<std::string>& arrayName) const
+{
+  const auto& data = useCellData ? this->CellDataColoringInfo : this->PointDataColoringInfo;
+  auto it = arrayName.has_value() ? data.upper_bound(arrayName.value()) : data.begin();
+  if (it == data.end())
+  {
+    return std::nullopt;
+  }
+  return it->first;
+}
@@ -36,7 +36,7 @@ public:
   void UpdateColoringInfo(vtkDataSet* dataset, bool useCellData);
 
   /**
-   * Clear all internal coloring maps
+   * Clear all internal coloring maps and the current coloring
    */
   void ClearColoringInfo();
 
@@ -67,6 +67,14 @@ public:
    */
   void CycleColoringArray(bool cycleToNonColoring);
 
+  /**
+   * Get the name of the first array, in the order used when cycling, that comes after the
+   * provided array name, or the first array if not provided.
+   * Return an unset optional if there is no such array.
+   */
+  std::optional<std::string> GetArrayNameAfter(
+    bool useCellData, const std::optional<std::string>& arrayName) const;
+
 private:
   // Map of arrayName -> coloring info
   using ColoringMap = std::map<std::string, ColoringInfo>;
@@ -0,0 +1,84 @@
+#include "F3DRenderStateTracker.h"
+
+#include <vtkCamera.h>
+#include <vtkLight.h>
+#include <vtkLightCollection.h>
+#include <vtkProp.h>
+#include <vtkRenderState.h>
+#include <vtkRenderer.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+//----------------------------------------------------------------------------
+bool F3DRenderStateTracker::Update(const vtkRenderState* state, int width, int height)
+{
+  vtkRenderer* renderer = state->GetRenderer();
+
+  vtkCamera* cam = renderer->GetActiveCamera();
+  std::array<double, 14> camera;
+  cam->GetPosition(&camera[0]);
+  cam->GetFocalPoint(&camera[3]);
+  cam->GetViewUp(&camera[6]);
+  cam->GetWindowCenter(&camera[9]);
+  camera[11] = cam->GetViewAngle();
+  camera[12] = cam->GetParallelScale();
+  camera[13] = cam->GetParallelProjection();
+
+  const std::array<int, 2> size = { width, height };
+
+  // Removing a prop does not change any modification time, so the count is tracked too
+  const int propCount = state->GetPropArrayCount();
+
+  vtkMTimeType sceneTime = 0;
+  vtkProp** props = state->GetPropArray();
+  for (int i = 0; i < propCount; i++)
+  {
+    sceneTime = std::max(sceneTime, props[i]->GetRedrawMTime());
+  }
+
+  // Headlights and camera lights follow the camera, which is tracked above, and are moved on each
+  // render, eg. to the reflected camera when baking a reflection, so their modification time
+  // always changes. Only their own parameters are tracked.
+  vtkLightCollection* lights = renderer->GetLights();
+  std::vector<double> cameraLights = { static_cast<double>(lights->GetNumberOfItems()) };
+  vtkCollectionSimpleIterator it;
+  vtkLight* light;
+  for (lights->InitTraversal(it); (light = lights->GetNextLight(it));)
+  {
+    if (light->LightTypeIsSceneLight())
+    {
+      sceneTime = std::max(sceneTime, light->GetMTime());
+      continue;
+    }
+
+    cameraLights.insert(cameraLights.end(),
+      { static_cast<double>(light->GetSwitch()), light->GetIntensity(),
+        static_cast<double>(light->GetPositional()), light->GetConeAngle(),
+        light->GetExponent() });
+    cameraLights.insert(cameraLights.end(), light->GetAmbientColor(), light->GetAmbientColor() + 3);
+    cameraLights.insert(cameraLights.end(), light->GetDiffuseColor(), light->GetDiffuseColor() + 3);
+    cameraLights.insert(
+      cameraLights.end(), light->GetSpecularColor(), light->GetSpecularColor() + 3);
+    cameraLights.insert(
+      cameraLights.end(), light->GetAttenuationValues(), light->GetAttenuationValues() + 3);
+    if (light->LightTypeIsCameraLight())
+    {
+      // expressed in the camera coordinates
+      cameraLights.insert(cameraLights.end(), light->GetPosition(), light->GetPosition() + 3);
+      cameraLights.insert(cameraLights.end(), light->GetFocalPoint(), light->GetFocalPoint() + 3);
+    }
+  }
+
+  const bool changed = !this->Valid || camera != this->Camera || size != this->Size ||
+    propCount != this->PropCount || sceneTime != this->SceneTime ||
+    cameraLights != this->CameraLights;
+  this->Valid = true;
+  this->Camera = camera;
+  this->Size = size;
+  this->PropCount = propCount;
+  this->SceneTime = sceneTime;
+  this->CameraLights = std::move(cameraLights);
+  return changed;
+}
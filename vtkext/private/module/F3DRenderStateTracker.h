@@ -0,0 +1,46 @@
+/**
+ * @class F3DRenderStateTracker
+ * @brief Detect changes in what a render state would produce
+ *
+ * Keep track of the active camera parameters, of the size of the rendered image,
+ * of the props of a render state and of the lights of its renderer, in order to know
+ * if the result of a previous render can be reused.
+ * Headlights and camera lights are tracked by their parameters, as they follow the camera.
+ * The camera modification time is not used as the clipping range is reset on each render.
+ */
+#ifndef F3DRenderStateTracker_h
+#define F3DRenderStateTracker_h
+
+#include <vtkType.h>
+
+#include <array>
+#include <vector>
+
+class vtkRenderState;
+class F3DRenderStateTracker
+{
+public:
+  /**
+   * Record the current state, rendered at the provided size.
+   * Return true if it differs from the previously recorded state, or if there is none.
+   */
+  bool Update(const vtkRenderState* state, int width, int height);
+
+  /**
+   * Forget the recorded state so that the next Update returns true
+   */
+  void Reset()
+  {
+    this->Valid = false;
+  }
+
+private:
+  bool Valid = false;
+  std::array<double, 14> Camera = {};
+  std::array<int, 2> Size = {};
+  int PropCount = 0;
+  vtkMTimeType SceneTime = 0;
+  std::vector<double> CameraLights;
+};
+
+#endif
@@ -0,0 +1,230 @@
+#include "F3DTextureCache.h"
+
+#include <vtkDataArray.h>
+#include <vtkFloatArray.h>
+#include <vtkImageData.h>
+#include <vtkPointData.h>
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+
+namespace
+{
+// "F3DT" in little endian
+constexpr uint32_t CacheMagic = 0x54443346;
+
+// Increment when the layout changes so that old cache files are regenerated
+constexpr uint32_t CacheVersion = 1;
+
+//----------------------------------------------------------------------------
+// Unique temporary path next to the provided one, so that concurrent writers do not interleave
+std::string GetTemporaryPath(const std::string& path)
+{
+  std::random_device device;
+  std::ostringstream tmpPath;
+  tmpPath << path << "." << std::hex << device() << device() << ".tmp";
+  return tmpPath.str();
+}
+}
+
+//----------------------------------------------------------------------------
+size_t F3DTextureCache::GetFaceByteSize(const Header& header, unsigned int level)
+{
+  size_t size = std::max(header.Size >> level, 1u);
+  return size * size * header.Components *
+    static_cast<size_t>(vtkDataArray::GetDataTypeSize(static_cast<int>(header.DataType)));
+}
+
+//----------------------------------------------------------------------------
+bool F3DTextureCache::Write(
+  const std::string& path, const std::vector<vtkImageData*>& levels, vtkFloatArray* metaData)
+{
+  if (levels.empty() || !levels[0] || !levels[0]->GetPointData()->GetScalars())
+  {
+    return false;
+  }
+
+  vtkDataArray* firstScalars = levels[0]->GetPointData()->GetScalars();
+  const int* firstDims = levels[0]->GetDimensions();
+
+  Header header;
+  header.Magic = ::CacheMagic;
+  header.Version = ::CacheVersion;
+  header.DataType = static_cast<uint32_t>(firstScalars->GetDataType());
+  header.Components = static_cast<uint32_t>(firstScalars->GetNumberOfComponents());
+  header.Faces = static_cast<uint32_t>(firstDims[2]);
+  header.Size = static_cast<uint32_t>(firstDims[0]);
+  header.Levels = static_cast<uint32_t>(levels.size());
+  if (metaData)
+  {
+    header.MetaDataComponents = static_cast<uint32_t>(metaData->GetNumberOfComponents());
+    header.MetaDataTuples = static_cast<uint32_t>(metaData->GetNumberOfTuples());
+  }
+
+  // Check all levels before writing anything
+  for (unsigned int i = 0; i < header.Levels; i++)
+  {
+    vtkDataArray* scalars = levels[i] ? levels[i]->GetPointData()->GetScalars() : nullptr;
+    size_t byteSize = F3DTextureCache::GetFaceByteSize(header, i) * header.Faces;
+    if (!scalars || scalars->GetDataType() != static_cast<int>(header.DataType) ||
+      static_cast<size_t>(scalars->GetDataSize() * scalars->GetDataTypeSize()) != byteSize)
+    {
+      return false;
+    }
+  }
+
+  // Write to a temporary file renamed on success, so that a partially written
+  // file is never read, even by another process sharing the cache directory
+  const std::string tmpPath = ::GetTemporaryPath(path);
+  bool written;
+  {
+    vtksys::ofstream file(tmpPath.c_str(), std::ios::binary);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    if (metaData)
+    {
+      file.write(reinterpret_cast<const char*>(metaData->GetPointer(0)),
+        static_cast<std::streamsize>(metaData->GetDataSize() * sizeof(float)));
+    }
+    for (unsigned int i = 0; i < header.Levels; i++)
+    {
+      vtkDataArray* scalars = levels[i]->GetPointData()->GetScalars();
+      file.write(static_cast<const char*>(scalars->GetVoidPointer(0)),
+        static_cast<std::streamsize>(F3DTextureCache::GetFaceByteSize(header, i) * header.Faces));
+    }
+    written = file.good();
+  }
+
+  if (!written || !vtksys::SystemTools::RenameFile(tmpPath, path))
+  {
+    vtksys::SystemTools::RemoveFile(tmpPath);
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool F3DTextureCache::Read(const std::string& path, bool headerOnly)
+{
+  this->MetaData.clear();
+  this->Pixels.clear();
+  this->LevelOffsets.clear();
+  this->FileHeader = Header();
+
+  vtksys::ifstream file(path.c_str(), std::ios::binary);
+  if (!file.is_open())
+  {
+    return false;
+  }
+
+  Header header;
+  if (!file.read(reinterpret_cast<char*>(&header), sizeof(Header)) ||
+    header.Magic != ::CacheMagic || header.Version != ::CacheVersion || header.Levels == 0 ||
+    header.Faces == 0 || vtkDataArray::GetDataTypeSize(static_cast<int>(header.DataType)) == 0)
+  {
+    return false;
+  }
+
+  this->MetaData.resize(static_cast<size_t>(header.MetaDataComponents) * header.MetaDataTuples);
+  if (!this->MetaData.empty() &&
+    !file.read(reinterpret_cast<char*>(this->MetaData.data()),
+      static_cast<std::streamsize>(this->MetaData.size() * sizeof(float))))
+  {
+    this->MetaData.clear();
+    return false;
+  }
+
+  size_t totalSize = 0;
+  for (unsigned int i = 0; i < header.Levels; i++)
+  {
+    this->LevelOffsets.emplace_back(totalSize);
+    totalSize += F3DTextureCache::GetFaceByteSize(header, i) * header.Faces;
+  }
+
+  if (headerOnly)
+  {
+    // Check the size of the pixels without reading them, to detect a truncated file
+    std::streamoff pixelsStart = file.tellg();
+    file.seekg(0, std::ios::end);
+    if (!file || file.tellg() - pixelsStart != static_cast<std::streamoff>(totalSize))
+    {
+      this->MetaData.clear();
+      this->LevelOffsets.clear();
+      return false;
+    }
+    this->LevelOffsets.clear();
+  }
+  else
+  {
+    // All pixels are read at once, they are uploaded directly from this buffer
+    this->Pixels.resize(totalSize);
+    if (!file.read(this->Pixels.data(), static_cast<std::streamsize>(totalSize)))
+    {
+      this->MetaData.clear();
+      this->Pixels.clear();
+      this->LevelOffsets.clear();
+      return false;
+    }
+  }
+
+  this->FileHeader = header;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+int F3DTextureCache::GetDataType() const
+{
+  return static_cast<int>(this->FileHeader.DataType);
+}
+
+//----------------------------------------------------------------------------
+unsigned int F3DTextureCache::GetNumberOfComponents() const
+{
+  return this->FileHeader.Components;
+}
+
+//----------------------------------------------------------------------------
+unsigned int F3DTextureCache::GetNumberOfFaces() const
+{
+  return this->FileHeader.Faces;
+}
+
+//----------------------------------------------------------------------------
+unsigned int F3DTextureCache::GetNumberOfLevels() const
+{
+  return this->FileHeader.Levels;
+}
+
+//----------------------------------------------------------------------------
+unsigned int F3DTextureCache::GetSize(unsigned int level) const
+{
+  return std::max(this->FileHeader.Size >> level, 1u);
+}
+
+//----------------------------------------------------------------------------
+const void* F3DTextureCache::GetData(unsigned int level, unsigned int face) const
+{
+  if (level >= this->LevelOffsets.size() || face >= this->FileHeader.Faces)
+  {
+    return nullptr;
+  }
+  return this->Pixels.data() + this->LevelOffsets[level] +
+    face * F3DTextureCache::GetFaceByteSize(this->FileHeader, level);
+}
+
+//----------------------------------------------------------------------------
+vtkFloatArray* F3DTextureCache::NewMetaData() const
+{
+  if (this->MetaData.empty())
+  {
+    return nullptr;
+  }
+
+  vtkFloatArray* array = vtkFloatArray::New();
+  array->SetNumberOfComponents(static_cast<int>(this->FileHeader.MetaDataComponents));
+  array->SetNumberOfTuples(this->FileHeader.MetaDataTuples);
+  std::copy(this->MetaData.begin(), this->MetaData.end(), array->GetPointer(0));
+  return array;
+}
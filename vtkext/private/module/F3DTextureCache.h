@@ -0,0 +1,86 @@
+/**
+ * @class F3DTextureCache
+ * @brief Read and write binary texture cache files
+ *
+ * A texture cache file is a small fixed header, followed by optional float metadata
+ * (eg. spherical harmonics coefficients) and by the raw pixels of every mip level and face,
+ * tightly packed. It is read with a single file read and the pixels can be uploaded to the GPU
+ * without any parsing nor conversion.
+ */
+#ifndef F3DTextureCache_h
+#define F3DTextureCache_h
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class vtkFloatArray;
+class vtkImageData;
+class F3DTextureCache
+{
+public:
+  /**
+   * Write a texture cache file.
+   * levels contains one image per mip level, the faces of a cube map being stacked along Z.
+   * All levels must have the same scalar type and number of components.
+   * metaData is optional and stored as is in the file.
+   * The file is written to a temporary file first and renamed, so that a partially written file
+   * is never read. Return false if the file cannot be written, no file is created in that case.
+   */
+  static bool Write(const std::string& path, const std::vector<vtkImageData*>& levels,
+    vtkFloatArray* metaData = nullptr);
+
+  /**
+   * Read a texture cache file in memory.
+   * If headerOnly is true, only the header and the metadata are read, and the size of the pixels
+   * is checked without reading them, which can be used to validate a file before using it.
+   * Return false if the file cannot be read or is not a valid texture cache file.
+   */
+  bool Read(const std::string& path, bool headerOnly = false);
+
+  ///@{
+  /**
+   * Accessors to the texture description, valid after a successful Read
+   */
+  int GetDataType() const;
+  unsigned int GetNumberOfComponents() const;
+  unsigned int GetNumberOfFaces() const;
+  unsigned int GetNumberOfLevels() const;
+  unsigned int GetSize(unsigned int level = 0) const;
+  ///@}
+
+  /**
+   * Get a pointer to the raw pixels of the given level and face.
+   * Return nullptr if the pixels were not read or if out of bounds.
+   */
+  const void* GetData(unsigned int level, unsigned int face) const;
+
+  /**
+   * Create a new float array containing the metadata stored in the file.
+   * Return nullptr if there is no metadata.
+   */
+  vtkFloatArray* NewMetaData() const;
+
+private:
+  struct Header
+  {
+    uint32_t Magic = 0;
+    uint32_t Version = 0;
+    uint32_t DataType = 0;
+    uint32_t Components = 0;
+    uint32_t Faces = 0;
+    uint32_t Size = 0;
+    uint32_t Levels = 0;
+    uint32_t MetaDataComponents = 0;
+    uint32_t MetaDataTuples = 0;
+  };
+
+  static size_t GetFaceByteSize(const Header& header, unsigned int level);
+
+  Header FileHeader;
+  std::vector<float> MetaData;
+  std::vector<char> Pixels;
+  std::vector<size_t> LevelOffsets;
+};
+
+#endif
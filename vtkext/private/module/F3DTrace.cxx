@@ -0,0 +1,176 @@
+#include "F3DTrace.h"
+
+#include <atomic>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+struct Event
+{
+  std::string Name;
+  const char* Category;
+  long long Start; // in microseconds since the recording was enabled
+  long long Duration;
+  int Thread;
+};
+
+struct TraceState
+{
+  std::atomic<bool> Enabled = false;
+  std::mutex Mutex;
+  std::chrono::steady_clock::time_point Origin;
+  std::vector<Event> Events;
+  std::map<std::thread::id, int> Threads;
+};
+
+TraceState& GetState()
+{
+  static TraceState state;
+  return state;
+}
+
+//----------------------------------------------------------------------------
+void WriteEscaped(std::ostream& stream, const std::string& str)
+{
+  for (char c : str)
+  {
+    switch (c)
+    {
+      case '"':
+        stream << "\\\"";
+        break;
+      case '\\':
+        stream << "\\\\";
+        break;
+      case '\n':
+        stream << "\\n";
+        break;
+      case '\t':
+        stream << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+          char buffer[7];
+          std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+          stream << buffer;
+        }
+        else
+        {
+          stream << c;
+        }
+    }
+  }
+}
+}
+
+//----------------------------------------------------------------------------
+void F3DTrace::SetEnabled(bool enable)
+{
+  TraceState& state = ::GetState();
+  std::scoped_lock lock(state.Mutex);
+  if (enable && !state.Enabled)
+  {
+    state.Events.clear();
+    state.Threads.clear();
+    state.Origin = std::chrono::steady_clock::now();
+  }
+  state.Enabled = enable;
+}
+
+//----------------------------------------------------------------------------
+bool F3DTrace::IsEnabled()
+{
+  return ::GetState().Enabled;
+}
+
+//----------------------------------------------------------------------------
+std::string F3DTrace::GetChromeTrace()
+{
+  TraceState& state = ::GetState();
+  std::scoped_lock lock(state.Mutex);
+
+  std::ostringstream json;
+  json << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  for (size_t i = 0; i < state.Events.size(); i++)
+  {
+    const Event& event = state.Events[i];
+    json << (i == 0 ? "" : ",") << "\n{\"name\":\"";
+    ::WriteEscaped(json, event.Name);
+    json << "\",\"cat\":\"" << event.Category << "\",\"ph\":\"X\",\"ts\":" << event.Start
+         << ",\"dur\":" << event.Duration << ",\"pid\":1,\"tid\":" << event.Thread << "}";
+  }
+  json << "\n]}\n";
+  return json.str();
+}
+
+//----------------------------------------------------------------------------
+F3DTrace::Scope::Scope(const char* name, const char* category)
+  : Category(category)
+{
+  if (::GetState().Enabled)
+  {
+    this->Begin(name);
+  }
+}
+
+//----------------------------------------------------------------------------
+F3DTrace::Scope::Scope(const char* name, std::string_view detail, const char* category)
+  : Category(category)
+{
+  if (::GetState().Enabled)
+  {
+    this->Begin(std::string(name).append(" ").append(detail));
+  }
+}
+
+//----------------------------------------------------------------------------
+F3DTrace::Scope::Scope(const char* name, std::size_t detail, const char* category)
+  : Category(category)
+{
+  if (::GetState().Enabled)
+  {
+    this->Begin(std::string(name) + " " + std::to_string(detail));
+  }
+}
+
+//----------------------------------------------------------------------------
+void F3DTrace::Scope::Begin(std::string name)
+{
+  this->Recording = true;
+  this->Name = std::move(name);
+  this->Start = std::chrono::steady_clock::now();
+}
+
+//----------------------------------------------------------------------------
+F3DTrace::Scope::~Scope()
+{
+  if (!this->Recording)
+  {
+    return;
+  }
+
+  auto end = std::chrono::steady_clock::now();
+  TraceState& state = ::GetState();
+  std::scoped_lock lock(state.Mutex);
+
+  // The recording may have been restarted while in this scope
+  if (!state.Enabled || this->Start < state.Origin)
+  {
+    return;
+  }
+
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+  auto thread = state.Threads.try_emplace(
+    std::this_thread::get_id(), static_cast<int>(state.Threads.size()) + 1);
+  state.Events.push_back({ std::move(this->Name), this->Category,
+    duration_cast<microseconds>(this->Start - state.Origin).count(),
+    duration_cast<microseconds>(end - this->Start).count(), thread.first->second });
+}
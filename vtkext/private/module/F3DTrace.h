@@ -0,0 +1,66 @@
+/**
+ * @class   F3DTrace
+ * @brief   Namespace containing methods to record a trace of timed scopes
+ *
+ * Provide an opt-in tracing facility recording the wall time spent in nested named scopes,
+ * eg: reading a file, setting up an actor or compiling a shader.
+ * The recorded events can be exported in the Chrome trace event JSON format, which can be
+ * opened with chrome://tracing or https://ui.perfetto.dev.
+ * Recording is disabled by default and a Scope does nothing but check a flag in that case.
+ * Events can be recorded from any thread.
+ */
+
+#ifndef F3DTrace_h
+#define F3DTrace_h
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace F3DTrace
+{
+/**
+ * Enable or disable the recording of events.
+ * Enabling the recording removes any previously recorded events.
+ */
+void SetEnabled(bool enable);
+
+/**
+ * Return true if events are being recorded
+ */
+bool IsEnabled();
+
+/**
+ * Get the recorded events in the Chrome trace event JSON format
+ */
+std::string GetChromeTrace();
+
+/**
+ * Scope guard recording the time spent between its construction and its destruction
+ * as a complete event with the provided name and category, if the recording is enabled
+ * when it is constructed.
+ * A detail, eg: a class name or an index, can be appended to the name. The name is only
+ * formatted when recording, so that a disabled scope never builds any string.
+ */
+class Scope
+{
+public:
+  explicit Scope(const char* name, const char* category = "f3d");
+  Scope(const char* name, std::string_view detail, const char* category);
+  Scope(const char* name, std::size_t detail, const char* category);
+  ~Scope();
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+
+private:
+  void Begin(std::string name);
+
+  bool Recording = false;
+  std::string Name;
+  const char* Category;
+  std::chrono::steady_clock::time_point Start;
+};
+};
+
+#endif
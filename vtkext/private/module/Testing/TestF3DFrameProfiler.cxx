@@ -0,0 +1,71 @@
+#include <vtkNew.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+
+#include "vtkF3DFrameProfiler.h"
+
+#include <iostream>
+
+int TestF3DFrameProfiler(int argc, char* argv[])
+{
+  vtkNew<vtkRenderer> renderer;
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->AddRenderer(renderer);
+  renWin->OffScreenRenderingOn();
+  renWin->Render();
+
+  vtkNew<vtkF3DFrameProfiler> profiler;
+
+  // scopes outside of a frame are ignored
+  profiler->EnabledOn();
+  profiler->StartScope("ignored");
+  profiler->EndScope();
+
+  // results are read back a few frames later, only when the GPU provided them
+  bool newTimings = false;
+  for (int i = 0; i < 100 && !newTimings; i++)
+  {
+    newTimings = profiler->StartFrame();
+    profiler->StartScope("frame");
+    profiler->StartScope("render");
+    renWin->Render();
+    profiler->EndScope();
+    profiler->EndScope();
+    profiler->EndFrame();
+  }
+  profiler->Print(std::cout);
+
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+  const std::vector<vtkF3DFrameProfiler::Timing>& timings = profiler->GetTimings();
+  if (!newTimings || timings.size() != 2)
+  {
+    std::cerr << "Timings were not read back" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (timings[0].Name != "frame" || timings[0].Depth != 0 || timings[1].Name != "render" ||
+    timings[1].Depth != 1)
+  {
+    std::cerr << "Unexpected scopes" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (timings[1].Time < 0.0 || timings[1].Time > timings[0].Time)
+  {
+    std::cerr << "Inconsistent timings" << std::endl;
+    return EXIT_FAILURE;
+  }
+#endif
+
+  profiler->ReleaseGraphicsResources();
+
+  // a disabled profiler never measures anything
+  profiler->EnabledOff();
+  if (profiler->StartFrame())
+  {
+    std::cerr << "A disabled profiler must not provide timings" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
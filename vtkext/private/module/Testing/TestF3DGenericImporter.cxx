@@ -1,8 +1,13 @@
+#include <vtkActor.h>
+#include <vtkActorCollection.h>
 #include <vtkConeSource.h>
 #include <vtkDataAssembly.h>
 #include <vtkDoubleArray.h>
 #include <vtkGLTFReader.h>
 #include <vtkInformation.h>
+#include <vtkInformationDoubleVectorKey.h>
+#include <vtkMapper.h>
+#include <vtkMatrix4x4.h>
 #include <vtkMultiBlockDataSet.h>
 #include <vtkMultiPieceDataSet.h>
 #include <vtkNew.h>
@@ -441,5 +446,42 @@ int TestF3DGenericImporter(int argc, char* argv[])
     }
   }
 
+  // Test MultiBlock sharing a block positioned with BLOCK_USER_MATRIX
+  {
+    vtkNew<vtkMultiBlockDataSet> mb;
+    mb->SetNumberOfBlocks(2);
+    mb->SetBlock(0, sphere->GetOutput());
+    mb->SetBlock(1, sphere->GetOutput());
+
+    vtkNew<vtkMatrix4x4> translation;
+    translation->SetElement(0, 3, 2.0);
+    mb->GetMetaData(1u)->Set(vtkF3DImporter::BLOCK_USER_MATRIX(), translation->GetData(), 16);
+
+    vtkNew<vtkTrivialProducer> producer;
+    producer->SetOutput(mb);
+
+    vtkNew<vtkF3DGenericImporter> importer;
+    importer->SetInternalReader(producer);
+    importer->Update();
+
+    vtkActorCollection* actors = importer->GetImportedActors();
+    vtkActor* actor0 = vtkActor::SafeDownCast(actors->GetItemAsObject(0));
+    vtkActor* actor1 = vtkActor::SafeDownCast(actors->GetItemAsObject(1));
+    if (!actor0 || !actor1 || actor0->GetUserMatrix() || !actor1->GetUserMatrix() ||
+      actor1->GetUserMatrix()->GetElement(0, 3) != 2.0)
+    {
+      std::cerr << "MB with BLOCK_USER_MATRIX: Unexpected actor user matrices\n";
+      return EXIT_FAILURE;
+    }
+
+    vtkPolyData* input0 = vtkPolyData::SafeDownCast(actor0->GetMapper()->GetInput());
+    vtkPolyData* input1 = vtkPolyData::SafeDownCast(actor1->GetMapper()->GetInput());
+    if (!input0 || !input1 || input0->GetPoints() != input1->GetPoints())
+    {
+      std::cerr << "MB with BLOCK_USER_MATRIX: Points should be shared between instances\n";
+      return EXIT_FAILURE;
+    }
+  }
+
   return EXIT_SUCCESS;
 }
@@ -1,9 +1,45 @@
+#include <vtkCallbackCommand.h>
 #include <vtkNew.h>
 #include <vtkRenderWindowInteractor.h>
+#include <vtkStringArray.h>
 #include <vtkTestUtilities.h>
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
 
 #include "vtkF3DInteractorEventRecorder.h"
 
+#include <iostream>
+#include <string>
+
+namespace
+{
+struct PlayedEvents
+{
+  int KeyPress = 0;
+  int Timer = 0;
+  int Render = 0;
+  std::string KeySym;
+  int Position[2] = { 0, 0 };
+  std::string DroppedFile;
+};
+
+void RecordEvents(vtkRenderWindowInteractor* inter)
+{
+  inter->SetEventInformation(10, 20, 0, 0, 'x', 1, "x");
+  inter->InvokeEvent(vtkCommand::KeyPressEvent, nullptr);
+  for (int i = 0; i < 100; i++)
+  {
+    inter->InvokeEvent(vtkCommand::TimerEvent, nullptr);
+  }
+  inter->SetEventInformation(5, 25, 1, 0, 0, 0, "Control_L");
+  inter->InvokeEvent(vtkCommand::RenderEvent, nullptr);
+
+  vtkNew<vtkStringArray> files;
+  files->InsertNextValue("/path/to/dropped file.vtp");
+  inter->InvokeEvent(vtkCommand::DropFilesEvent, files);
+}
+}
+
 int TestF3DInteractorEventRecorder(int argc, char* argv[])
 {
   vtkNew<vtkF3DInteractorEventRecorder> record;
@@ -15,5 +51,112 @@ int TestF3DInteractorEventRecorder(int argc, char* argv[])
   record->SetEnabled(1);
   record->SetInteractor(nullptr);
 
-  return record->GetEnabled() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+  if (record->GetEnabled() != 0)
+  {
+    std::cerr << "Recorder still enabled after removing the interactor" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Record events in the binary format
+  std::string fileName = std::string(argv[2]) + "/TestF3DInteractorEventRecorder" +
+    vtkF3DInteractorEventRecorder::BINARY_EXTENSION;
+  vtkNew<vtkRenderWindowInteractor> recordInter;
+  vtkNew<vtkF3DInteractorEventRecorder> binaryRecord;
+  binaryRecord->SetInteractor(recordInter);
+  binaryRecord->SetFileName(fileName.c_str());
+  binaryRecord->On();
+  binaryRecord->Record();
+  ::RecordEvents(recordInter);
+  binaryRecord->Off();
+  binaryRecord->Clear();
+
+  // Repeated timer events must be stored as a single byte
+  unsigned long size = vtksys::SystemTools::FileLength(fileName);
+  if (size == 0 || size > 400)
+  {
+    std::cerr << "Unexpected binary recording size: " << size << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Play the events back, counting them
+  vtkNew<vtkRenderWindowInteractor> playInter;
+  PlayedEvents played;
+  vtkNew<vtkCallbackCommand> callback;
+  callback->SetClientData(&played);
+  callback->SetCallback(
+    [](vtkObject* caller, unsigned long event, void* clientData, void* callData)
+    {
+      PlayedEvents* self = static_cast<PlayedEvents*>(clientData);
+      vtkRenderWindowInteractor* rwi = static_cast<vtkRenderWindowInteractor*>(caller);
+      switch (event)
+      {
+        case vtkCommand::KeyPressEvent:
+          self->KeyPress++;
+          self->KeySym = rwi->GetKeySym();
+          break;
+        case vtkCommand::TimerEvent:
+          self->Timer++;
+          break;
+        case vtkCommand::RenderEvent:
+          self->Render++;
+          rwi->GetEventPosition(self->Position);
+          break;
+        case vtkCommand::DropFilesEvent:
+          self->DroppedFile = static_cast<vtkStringArray*>(callData)->GetValue(0);
+          break;
+        default:
+          break;
+      }
+    });
+  playInter->AddObserver(vtkCommand::KeyPressEvent, callback);
+  playInter->AddObserver(vtkCommand::TimerEvent, callback);
+  playInter->AddObserver(vtkCommand::RenderEvent, callback);
+  playInter->AddObserver(vtkCommand::DropFilesEvent, callback);
+
+  vtkNew<vtkF3DInteractorEventRecorder> player;
+  player->SetInteractor(playInter);
+  player->SetFileName(fileName.c_str());
+  player->CheckpointsOnlyOn();
+  player->Play();
+
+  if (played.KeyPress != 1 || played.Timer != 100 || played.Render != 1 ||
+    played.KeySym != "x" || played.Position[0] != 5 || played.Position[1] != 25 ||
+    played.DroppedFile != "/path/to/dropped file.vtp")
+  {
+    std::cerr << "Unexpected played events: " << played.KeyPress << " key press, " << played.Timer
+              << " timer, " << played.Render << " render, key sym " << played.KeySym
+              << ", position " << played.Position[0] << " " << played.Position[1]
+              << ", dropped file " << played.DroppedFile << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (!playInter->GetEnableRender())
+  {
+    std::cerr << "Rendering was not enabled again after playing" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Text recordings older than 1.1 are played by VTK instead
+  std::string oldFileName = std::string(argv[2]) + "/TestF3DInteractorEventRecorderOld.log";
+  {
+    vtksys::ofstream oldFile(oldFileName.c_str());
+    oldFile << "# StreamVersion 1\n"
+            << "KeyPressEvent 10 20 0 0 120 1 x\n"
+            << "RenderEvent 5 25 0 0 0 0 Control_L\n";
+  }
+
+  played = PlayedEvents();
+  player->SetFileName(oldFileName.c_str());
+  player->Play();
+
+  if (played.KeyPress != 1 || played.Render != 1 || played.KeySym != "x" ||
+    !player->GetCheckpointsOnly())
+  {
+    std::cerr << "Unexpected played events with an old recording: " << played.KeyPress
+              << " key press, " << played.Render << " render, key sym " << played.KeySym
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
 }
@@ -91,5 +91,29 @@ int TestF3DMetaImporterMultiColoring(int argc, char* argv[])
     return EXIT_FAILURE;
   }
 
+  // Test memory usage, derived actors are not visible
+  auto usages = importer->GetMemoryUsage();
+  if (usages.size() != 2)
+  {
+    std::cerr << "Unexpected number of importer memory usages: " << usages.size() << "\n";
+    return EXIT_FAILURE;
+  }
+  for (const auto& usage : usages)
+  {
+    if (usage.Actors.size() != 1 || usage.Total.HostBytes <= 0 ||
+      usage.Total.GeometryBytes <= 0 || usage.Total.AuxiliaryBytes != 0)
+    {
+      std::cerr << "Unexpected memory usage of " << usage.Name << ": " << usage.Total.HostBytes
+                << " host bytes, " << usage.Total.GeometryBytes << " geometry bytes, "
+                << usage.Total.AuxiliaryBytes << " auxiliary bytes\n";
+      return EXIT_FAILURE;
+    }
+  }
+  if (importer->GetMetaDataDescription(true).find("Host memory: ") == std::string::npos)
+  {
+    std::cerr << "Memory usage missing from the meta data description\n";
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
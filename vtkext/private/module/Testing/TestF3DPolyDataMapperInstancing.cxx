@@ -0,0 +1,69 @@
+#include <vtkActor.h>
+#include <vtkCubeSource.h>
+#include <vtkInformation.h>
+#include <vtkInformationDoubleVectorKey.h>
+#include <vtkNew.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+
+#include "vtkF3DImporter.h"
+#include "vtkF3DPolyDataMapper.h"
+
+#include <iostream>
+
+int TestF3DPolyDataMapperInstancing(int argc, char* argv[])
+{
+  vtkNew<vtkCubeSource> cube;
+
+  vtkNew<vtkF3DPolyDataMapper> mapper;
+  mapper->SetInputConnection(cube->GetOutputPort());
+
+  // Two instances, translated along X and scaled along Y
+  // clang-format off
+  const double matrices[32] = {
+    1, 0, 0, -2,
+    0, 1, 0, 0,
+    0, 0, 1, 0,
+    0, 0, 0, 1,
+
+    1, 0, 0, 2,
+    0, 3, 0, 0,
+    0, 0, 1, 0,
+    0, 0, 0, 1,
+  };
+  // clang-format on
+  mapper->GetInformation()->Set(vtkF3DImporter::MAPPER_INSTANCE_MATRICES(), matrices, 32);
+
+  const double* bounds = mapper->GetBounds();
+  if (bounds[0] != -2.5 || bounds[1] != 2.5 || bounds[2] != -1.5 || bounds[3] != 1.5 ||
+    bounds[4] != -0.5 || bounds[5] != 0.5)
+  {
+    std::cerr << "Instanced bounds are incorrect: " << bounds[0] << " " << bounds[1] << " "
+              << bounds[2] << " " << bounds[3] << " " << bounds[4] << " " << bounds[5] << "\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(actor);
+
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->AddRenderer(renderer);
+  renWin->OffScreenRenderingOn();
+  renWin->Render();
+
+  // render again without instancing to check the shaders are rebuilt
+  mapper->GetInformation()->Remove(vtkF3DImporter::MAPPER_INSTANCE_MATRICES());
+  renWin->Render();
+
+  bounds = mapper->GetBounds();
+  if (bounds[0] != -0.5 || bounds[1] != 0.5)
+  {
+    std::cerr << "Non instanced bounds are incorrect\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,133 @@
+#include <vtkActor.h>
+#include <vtkCubeSource.h>
+#include <vtkDataObject.h>
+#include <vtkHardwareSelector.h>
+#include <vtkInformation.h>
+#include <vtkInformationDoubleVectorKey.h>
+#include <vtkInformationObjectBaseKey.h>
+#include <vtkNew.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkSelection.h>
+#include <vtkSelectionNode.h>
+#include <vtkSmartPointer.h>
+
+#include "vtkF3DCellPicker.h"
+#include "vtkF3DImporter.h"
+#include "vtkF3DPointPicker.h"
+#include "vtkF3DPolyDataMapper.h"
+
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+// Convert a world point to display coordinates
+void WorldToDisplay(vtkRenderer* renderer, double x, double y, double z, double display[2])
+{
+  renderer->SetWorldPoint(x, y, z, 1.0);
+  renderer->WorldToDisplay();
+  display[0] = renderer->GetDisplayPoint()[0];
+  display[1] = renderer->GetDisplayPoint()[1];
+}
+
+bool IsNear(const double* a, double x, double y, double z)
+{
+  return std::abs(a[0] - x) < 1e-3 && std::abs(a[1] - y) < 1e-3 && std::abs(a[2] - z) < 1e-3;
+}
+}
+
+int TestF3DPolyDataMapperInstancingPicking(int argc, char* argv[])
+{
+  vtkNew<vtkCubeSource> cube;
+
+  vtkNew<vtkF3DPolyDataMapper> mapper;
+  mapper->SetInputConnection(cube->GetOutputPort());
+
+  // Two instances, translated along X and scaled along Y, none at the origin
+  // clang-format off
+  const double matrices[32] = {
+    1, 0, 0, -2,
+    0, 1, 0, 0,
+    0, 0, 1, 0,
+    0, 0, 0, 1,
+
+    1, 0, 0, 2,
+    0, 3, 0, 0,
+    0, 0, 1, 0,
+    0, 0, 0, 1,
+  };
+  // clang-format on
+  mapper->GetInformation()->Set(vtkF3DImporter::MAPPER_INSTANCE_MATRICES(), matrices, 32);
+
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(actor);
+  renderer->ResetCamera();
+
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetSize(300, 300);
+  renWin->AddRenderer(renderer);
+  renWin->OffScreenRenderingOn();
+  renWin->Render();
+
+  double display[2];
+  vtkNew<vtkF3DCellPicker> cellPicker;
+
+  // The front face of the second instance is picked in world coordinates
+  WorldToDisplay(renderer, 2.0, 1.0, 0.5, display);
+  if (!cellPicker->Pick(display[0], display[1], 0, renderer) ||
+    !IsNear(cellPicker->GetPickPosition(), 2.0, 1.0, 0.5) ||
+    !IsNear(cellPicker->GetPickNormal(), 0.0, 0.0, 1.0))
+  {
+    const double* pos = cellPicker->GetPickPosition();
+    std::cerr << "Cell picking on an instance is incorrect: " << pos[0] << " " << pos[1] << " "
+              << pos[2] << "\n";
+    return EXIT_FAILURE;
+  }
+
+  // The instanced geometry itself is not displayed and must not be picked
+  WorldToDisplay(renderer, 0.0, 0.0, 0.5, display);
+  if (cellPicker->Pick(display[0], display[1], 0, renderer))
+  {
+    std::cerr << "Cell picking hit the instanced geometry instead of its instances\n";
+    return EXIT_FAILURE;
+  }
+
+  // The picked point is a corner of the second instance
+  vtkNew<vtkF3DPointPicker> pointPicker;
+  WorldToDisplay(renderer, 2.5, 1.5, 0.5, display);
+  if (!pointPicker->Pick(display[0], display[1], 0, renderer) ||
+    !IsNear(pointPicker->GetPickPosition(), 2.5, 1.5, 0.5))
+  {
+    const double* pos = pointPicker->GetPickPosition();
+    std::cerr << "Point picking on an instance is incorrect: " << pos[0] << " " << pos[1] << " "
+              << pos[2] << "\n";
+    return EXIT_FAILURE;
+  }
+
+  // Hardware selection of cells and points draws all instances
+  for (int association :
+    { vtkDataObject::FIELD_ASSOCIATION_CELLS, vtkDataObject::FIELD_ASSOCIATION_POINTS })
+  {
+    vtkNew<vtkHardwareSelector> selector;
+    selector->SetRenderer(renderer);
+    selector->SetFieldAssociation(association);
+    WorldToDisplay(renderer, 2.0, 1.0, 0.5, display);
+    selector->SetArea(static_cast<unsigned int>(display[0]) - 5,
+      static_cast<unsigned int>(display[1]) - 5, static_cast<unsigned int>(display[0]) + 5,
+      static_cast<unsigned int>(display[1]) + 5);
+    vtkSmartPointer<vtkSelection> selection;
+    selection.TakeReference(selector->Select());
+    if (!selection || selection->GetNumberOfNodes() != 1 ||
+      selection->GetNode(0)->GetProperties()->Get(vtkSelectionNode::PROP()) != actor.Get())
+    {
+      std::cerr << "Hardware selection of an instance failed\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
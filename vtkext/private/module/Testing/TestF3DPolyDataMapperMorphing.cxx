@@ -0,0 +1,91 @@
+#include <vtkActor.h>
+#include <vtkCamera.h>
+#include <vtkCubeSource.h>
+#include <vtkFloatArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPolyData.h>
+#include <vtkProperty.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkShaderProperty.h>
+#include <vtkUniforms.h>
+#include <vtkUnsignedCharArray.h>
+
+#include "vtkF3DPolyDataMapper.h"
+
+#include <iostream>
+
+namespace
+{
+// Return true if the pixel at the display position of the world point is not black
+bool IsCovered(vtkRenderer* renderer, vtkRenderWindow* renWin, double x, double y, double z)
+{
+  renderer->SetWorldPoint(x, y, z, 1.0);
+  renderer->WorldToDisplay();
+  const double* display = renderer->GetDisplayPoint();
+  const int px = static_cast<int>(display[0]);
+  const int py = static_cast<int>(display[1]);
+
+  vtkNew<vtkUnsignedCharArray> pixel;
+  renWin->GetPixelData(px, py, px, py, 1, pixel);
+  return pixel->GetValue(0) > 0 || pixel->GetValue(1) > 0 || pixel->GetValue(2) > 0;
+}
+}
+
+int TestF3DPolyDataMapperMorphing(int argc, char* argv[])
+{
+  vtkNew<vtkCubeSource> cube;
+  cube->Update();
+
+  // A single morph target moving all points by 2 along X
+  vtkNew<vtkPolyData> polyData;
+  polyData->ShallowCopy(cube->GetOutput());
+  vtkNew<vtkFloatArray> target;
+  target->SetName("target0_position");
+  target->SetNumberOfComponents(3);
+  target->SetNumberOfTuples(polyData->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < target->GetNumberOfTuples(); i++)
+  {
+    target->SetTuple3(i, 2.0, 0.0, 0.0);
+  }
+  polyData->GetPointData()->AddArray(target);
+
+  vtkNew<vtkF3DPolyDataMapper> mapper;
+  mapper->SetInputData(polyData);
+
+  const double* bounds = mapper->GetBounds();
+  if (bounds[0] != -0.5 || bounds[1] != 2.5 || bounds[2] != -0.5 || bounds[3] != 0.5)
+  {
+    std::cerr << "Morphed bounds are incorrect: " << bounds[0] << " " << bounds[1] << " "
+              << bounds[2] << " " << bounds[3] << "\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+  actor->GetProperty()->LightingOff();
+  actor->GetProperty()->SetColor(1.0, 1.0, 1.0);
+  const float weight = 1.f;
+  actor->GetShaderProperty()->GetVertexCustomUniforms()->SetUniform1fv("morphWeights", 1, &weight);
+
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(actor);
+  renderer->SetBackground(0.0, 0.0, 0.0);
+  renderer->ResetCamera();
+
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetSize(300, 300);
+  renWin->AddRenderer(renderer);
+  renWin->OffScreenRenderingOn();
+  renWin->Render();
+
+  // The cube is displaced on the GPU, only its morphed location is covered
+  if (!IsCovered(renderer, renWin, 2.0, 0.0, 0.5) || IsCovered(renderer, renWin, -0.3, 0.0, 0.5))
+  {
+    std::cerr << "Morph target is not applied when rendering\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
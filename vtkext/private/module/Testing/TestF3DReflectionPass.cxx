@@ -0,0 +1,81 @@
+#include <vtkActor.h>
+#include <vtkCamera.h>
+#include <vtkCameraPass.h>
+#include <vtkNew.h>
+#include <vtkOpaquePass.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkProperty.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkSphereSource.h>
+#include <vtkTextureObject.h>
+
+#include "vtkF3DReflectionPass.h"
+
+#include <iostream>
+
+int TestF3DReflectionPass(int argc, char* argv[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  vtkNew<vtkPolyDataMapper> mapper;
+  mapper->SetInputConnection(sphere->GetOutputPort());
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+
+  vtkNew<vtkOpaquePass> opaqueP;
+  vtkNew<vtkCameraPass> camP;
+  camP->SetDelegatePass(opaqueP);
+
+  vtkNew<vtkF3DReflectionPass> reflectionP;
+  reflectionP->SetDelegatePass(camP);
+  reflectionP->SetResolutionScale(0.5);
+  reflectionP->Print(std::cout);
+
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(actor);
+  renderer->SetPass(reflectionP);
+
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetSize(300, 200);
+  renWin->AddRenderer(renderer);
+  renWin->OffScreenRenderingOn();
+  renWin->Render();
+
+  if (!reflectionP->GetRendered())
+  {
+    std::cerr << "The reflection was not rendered" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (reflectionP->GetColorTexture()->GetWidth() != 150 ||
+    reflectionP->GetDepthTexture()->GetHeight() != 100)
+  {
+    std::cerr << "Unexpected reflection size" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  renWin->Render();
+  if (reflectionP->GetRendered())
+  {
+    std::cerr << "The reflection was rendered again without any change" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  renderer->GetActiveCamera()->Azimuth(10);
+  renWin->Render();
+  if (!reflectionP->GetRendered())
+  {
+    std::cerr << "The reflection was not rendered after a camera change" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  actor->GetProperty()->SetColor(1.0, 0.0, 0.0);
+  renWin->Render();
+  if (!reflectionP->GetRendered())
+  {
+    std::cerr << "The reflection was not rendered after a prop change" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -1,3 +1,4 @@
+#include <vtkCamera.h>
 #include <vtkNew.h>
 #include <vtkRenderWindow.h>
 #include <vtkRenderer.h>
@@ -52,5 +53,27 @@ int TestF3DRenderPass(int argc, char* argv[])
   // render a second time to check if recompilation skipping is working
   renWin->Render();
 
+  // TAA converges after the requested number of samples, unless something changes
+  taaP->SetNumberOfSamples(4);
+  for (int i = 0; i < 4; i++)
+  {
+    renWin->Render();
+  }
+
+  if (!taaP->IsConverged())
+  {
+    std::cerr << "TAA did not converge" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  renderer->GetActiveCamera()->Azimuth(10);
+  renWin->Render();
+
+  if (taaP->IsConverged())
+  {
+    std::cerr << "TAA did not restart after a camera change" << std::endl;
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
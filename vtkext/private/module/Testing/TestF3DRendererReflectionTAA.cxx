@@ -0,0 +1,53 @@
+#include <vtkCamera.h>
+#include <vtkNew.h>
+#include <vtkRenderWindow.h>
+#include <vtkSphereSource.h>
+
+#include "vtkF3DGenericImporter.h"
+#include "vtkF3DMetaImporter.h"
+#include "vtkF3DRenderer.h"
+
+#include <iostream>
+
+int TestF3DRendererReflectionTAA(int, char*[])
+{
+  vtkNew<vtkF3DRenderer> renderer;
+  vtkNew<vtkF3DMetaImporter> importer;
+  vtkNew<vtkRenderWindow> window;
+  window->SetSize(300, 300);
+  window->SetOffScreenRendering(true);
+  window->AddRenderer(renderer);
+  importer->SetRenderWindow(window);
+  renderer->SetImporter(importer);
+  renderer->Initialize();
+
+  vtkNew<vtkSphereSource> sphere;
+  vtkNew<vtkF3DGenericImporter> genericImporter;
+  genericImporter->SetInternalReader(sphere);
+  importer->AddImporter({ "sphere", genericImporter });
+  importer->Update();
+
+  // the default light kit contains a headlight and camera lights, which are moved on each render
+  renderer->ShowGrid(true);
+  renderer->SetGridReflection(0.5);
+  renderer->SetAntiAliasingMode(vtkF3DRenderer::AntiAliasingMode::TAA);
+  renderer->SetTAASamples(4);
+  renderer->UpdateActors();
+
+  renderer->ResetCamera();
+  renderer->GetActiveCamera()->Elevation(30);
+
+  for (int i = 0; i < 8; i++)
+  {
+    renderer->UpdateActors();
+    window->Render();
+  }
+
+  if (!renderer->IsRenderConverged())
+  {
+    std::cerr << "TAA did not converge with a reflection and camera following lights\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,76 @@
+#include <vtkActor.h>
+#include <vtkNew.h>
+#include <vtkOpenGLRenderWindow.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkRenderer.h>
+#include <vtkSphereSource.h>
+#include <vtksys/SystemTools.hxx>
+
+#include "vtkF3DShaderCache.h"
+
+#include <iostream>
+
+namespace
+{
+vtkF3DShaderCache* RenderSphere(vtkOpenGLRenderWindow* renWin, const std::string& directory)
+{
+  vtkNew<vtkSphereSource> sphere;
+  vtkNew<vtkPolyDataMapper> mapper;
+  mapper->SetInputConnection(sphere->GetOutputPort());
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(actor);
+
+  vtkF3DShaderCache* cache = vtkF3DShaderCache::Install(renWin);
+  cache->SetCacheDirectory(directory);
+
+  renWin->AddRenderer(renderer);
+  renWin->OffScreenRenderingOn();
+  renWin->Render();
+  return cache;
+}
+}
+
+int TestF3DShaderCache(int argc, char* argv[])
+{
+  std::string directory = std::string(argv[2]) + "/TestF3DShaderCache";
+  vtksys::SystemTools::RemoveADirectory(directory);
+  vtksys::SystemTools::MakeDirectory(directory);
+
+  vtkSmartPointer<vtkOpenGLRenderWindow> renWin =
+    vtkOpenGLRenderWindow::SafeDownCast(vtkSmartPointer<vtkRenderWindow>::New());
+  if (!renWin)
+  {
+    std::cerr << "Not an OpenGL render window" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkF3DShaderCache* cache = ::RenderSphere(renWin, directory);
+  if (cache->GetNumberOfLoadedPrograms() != 0)
+  {
+    std::cerr << "Programs unexpectedly loaded from an empty cache" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (cache->GetNumberOfSavedPrograms() == 0)
+  {
+    // The driver does not support program binaries, nothing else to check
+    std::cout << "Program binaries are not supported" << std::endl;
+    return EXIT_SUCCESS;
+  }
+
+  // A new render window must reuse the programs saved by the first one
+  vtkSmartPointer<vtkOpenGLRenderWindow> renWin2 =
+    vtkOpenGLRenderWindow::SafeDownCast(vtkSmartPointer<vtkRenderWindow>::New());
+  vtkF3DShaderCache* cache2 = ::RenderSphere(renWin2, directory);
+  if (cache2->GetNumberOfLoadedPrograms() == 0 || cache2->GetNumberOfSavedPrograms() != 0)
+  {
+    std::cerr << "Programs were not loaded from the cache: "
+              << cache2->GetNumberOfLoadedPrograms() << " loaded, "
+              << cache2->GetNumberOfSavedPrograms() << " saved" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,134 @@
+#include <vtkFloatArray.h>
+#include <vtkImageData.h>
+#include <vtkNew.h>
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include "F3DTextureCache.h"
+
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+int TestF3DTextureCache(int argc, char* argv[])
+{
+  std::string path = std::string(argv[2]) + "/TestF3DTextureCache.f3dtex";
+
+  // A two levels cube map with a few metadata
+  vtkNew<vtkImageData> level0;
+  level0->SetDimensions(4, 4, 6);
+  level0->AllocateScalars(VTK_FLOAT, 3);
+  vtkNew<vtkImageData> level1;
+  level1->SetDimensions(2, 2, 6);
+  level1->AllocateScalars(VTK_FLOAT, 3);
+
+  float* data0 = static_cast<float*>(level0->GetScalarPointer());
+  for (int i = 0; i < 4 * 4 * 6 * 3; i++)
+  {
+    data0[i] = static_cast<float>(i);
+  }
+  float* data1 = static_cast<float*>(level1->GetScalarPointer());
+  for (int i = 0; i < 2 * 2 * 6 * 3; i++)
+  {
+    data1[i] = static_cast<float>(-i);
+  }
+
+  vtkNew<vtkFloatArray> metaData;
+  metaData->SetNumberOfComponents(3);
+  metaData->SetNumberOfTuples(9);
+  for (int i = 0; i < 27; i++)
+  {
+    metaData->SetValue(i, 0.5f * static_cast<float>(i));
+  }
+
+  if (!F3DTextureCache::Write(path, { level0, level1 }, metaData))
+  {
+    std::cerr << "Cannot write texture cache file" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  F3DTextureCache cache;
+  if (!cache.Read(path))
+  {
+    std::cerr << "Cannot read texture cache file" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (cache.GetDataType() != VTK_FLOAT || cache.GetNumberOfComponents() != 3 ||
+    cache.GetNumberOfFaces() != 6 || cache.GetNumberOfLevels() != 2 || cache.GetSize() != 4 ||
+    cache.GetSize(1) != 2)
+  {
+    std::cerr << "Unexpected texture cache header" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (std::memcmp(cache.GetData(0, 5), level0->GetScalarPointer(0, 0, 5), 4 * 4 * 3 * 4) != 0 ||
+    std::memcmp(cache.GetData(1, 2), level1->GetScalarPointer(0, 0, 2), 2 * 2 * 3 * 4) != 0)
+  {
+    std::cerr << "Unexpected texture cache pixels" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (cache.GetData(2, 0) || cache.GetData(0, 6))
+  {
+    std::cerr << "Out of bounds data should be nullptr" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkFloatArray* readMetaData = cache.NewMetaData();
+  if (!readMetaData || readMetaData->GetNumberOfComponents() != 3 ||
+    readMetaData->GetNumberOfTuples() != 9 || readMetaData->GetValue(26) != 13.f)
+  {
+    std::cerr << "Unexpected texture cache metadata" << std::endl;
+    if (readMetaData)
+    {
+      readMetaData->Delete();
+    }
+    return EXIT_FAILURE;
+  }
+  readMetaData->Delete();
+
+  // Header only read should not load pixels
+  if (!cache.Read(path, true) || cache.GetData(0, 0) || cache.GetNumberOfLevels() != 2)
+  {
+    std::cerr << "Unexpected header only read" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Invalid files
+  if (cache.Read(std::string(argv[1]) + "data/cow.vtp") || cache.Read(path + ".invalid"))
+  {
+    std::cerr << "Invalid texture cache file should not be read" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A truncated file must be detected, even when reading the header only
+  std::string truncatedPath = std::string(argv[2]) + "/TestF3DTextureCacheTruncated.f3dtex";
+  {
+    vtksys::ifstream file(path.c_str(), std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    vtksys::ofstream truncated(truncatedPath.c_str(), std::ios::binary);
+    truncated.write(content.data(), static_cast<std::streamsize>(content.size() - 16));
+  }
+  if (cache.Read(truncatedPath, true) || cache.Read(truncatedPath))
+  {
+    std::cerr << "Truncated texture cache file should not be read" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A failed write must not create a file
+  std::string failedPath = std::string(argv[2]) + "/TestF3DTextureCacheFailed.f3dtex";
+  vtksys::SystemTools::RemoveFile(failedPath);
+  vtkNew<vtkImageData> invalidLevel;
+  invalidLevel->SetDimensions(3, 3, 6);
+  invalidLevel->AllocateScalars(VTK_FLOAT, 3);
+  if (F3DTextureCache::Write(failedPath, { level0, invalidLevel }) ||
+    vtksys::SystemTools::FileExists(failedPath))
+  {
+    std::cerr << "Invalid levels should not be written" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,48 @@
+#include "F3DTrace.h"
+
+#include <iostream>
+#include <string>
+
+int TestF3DTrace(int argc, char* argv[])
+{
+  // Nothing is recorded by default
+  {
+    F3DTrace::Scope scope("disabled");
+  }
+  if (F3DTrace::IsEnabled() || F3DTrace::GetChromeTrace().find("disabled") != std::string::npos)
+  {
+    std::cerr << "Trace is recorded while disabled" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  F3DTrace::SetEnabled(true);
+  {
+    F3DTrace::Scope load("load \"file\"", "load");
+    F3DTrace::Scope read("read", "load");
+  }
+  F3DTrace::SetEnabled(false);
+  {
+    F3DTrace::Scope scope("disabled");
+  }
+
+  std::string trace = F3DTrace::GetChromeTrace();
+  if (trace.find(R"("name":"load \"file\"","cat":"load","ph":"X")") == std::string::npos ||
+    trace.find(R"("name":"read")") == std::string::npos ||
+    trace.find("disabled") != std::string::npos)
+  {
+    std::cerr << "Unexpected trace: " << trace << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Enabling again removes the previous events
+  F3DTrace::SetEnabled(true);
+  trace = F3DTrace::GetChromeTrace();
+  F3DTrace::SetEnabled(false);
+  if (trace.find("read") != std::string::npos)
+  {
+    std::cerr << "Trace not cleared when enabled: " << trace << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
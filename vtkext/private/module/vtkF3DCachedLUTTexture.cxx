@@ -1,12 +1,12 @@
 #include "vtkF3DCachedLUTTexture.h"
 
-#include <vtkImageData.h>
+#include "F3DTextureCache.h"
+
 #include <vtkObjectFactory.h>
 #include <vtkOpenGLRenderWindow.h>
 #include <vtkRenderer.h>
 #include <vtkTextureObject.h>
 #include <vtkVersion.h>
-#include <vtkXMLImageDataReader.h>
 #include <vtk_glad.h>
 
 vtkStandardNewMacro(vtkF3DCachedLUTTexture);
@@ -49,26 +49,29 @@ void vtkF3DCachedLUTTexture::Load(vtkRenderer* ren)
     this->TextureObject->SetMinificationFilter(vtkTextureObject::Linear);
     this->TextureObject->SetMagnificationFilter(vtkTextureObject::Linear);
 
-    vtkNew<vtkXMLImageDataReader> reader;
-    reader->SetFileName(this->FileName.c_str());
-    reader->Update();
-
-    vtkImageData* img = reader->GetOutput();
-    int dims[3];
-    img->GetDimensions(dims);
-    if (dims[0] != dims[1])
+    F3DTextureCache cache;
+    if (!cache.Read(this->FileName) || cache.GetNumberOfFaces() != 1 ||
+      cache.GetNumberOfComponents() != 2)
     {
-      vtkWarningMacro("LUT cache has unexpected dimensions");
+      vtkErrorMacro("Cannot read LUT cache file " << this->FileName);
+      return;
     }
-    this->LUTSize = dims[0];
+
+    this->LUTSize = cache.GetSize();
 
 #ifdef GL_ES_VERSION_3_0
-    this->TextureObject->Create2DFromRaw(
-      this->LUTSize, this->LUTSize, 2, VTK_UNSIGNED_CHAR, img->GetScalarPointer());
+    int dataType = VTK_UNSIGNED_CHAR;
 #else
-    this->TextureObject->Create2DFromRaw(
-      this->LUTSize, this->LUTSize, 2, VTK_UNSIGNED_SHORT, img->GetScalarPointer());
+    int dataType = VTK_UNSIGNED_SHORT;
 #endif
+    if (cache.GetDataType() != dataType)
+    {
+      vtkErrorMacro("LUT cache has unexpected data type");
+      return;
+    }
+
+    this->TextureObject->Create2DFromRaw(
+      this->LUTSize, this->LUTSize, 2, dataType, const_cast<void*>(cache.GetData(0, 0)));
 
     this->RenderWindow = renWin;
     this->LoadTime.Modified();
@@ -1,13 +1,12 @@
 #include "vtkF3DCachedSpecularTexture.h"
 
-#include <vtkImageData.h>
-#include <vtkMultiBlockDataSet.h>
+#include "F3DTextureCache.h"
+
 #include <vtkObjectFactory.h>
 #include <vtkOpenGLRenderWindow.h>
 #include <vtkRenderer.h>
 #include <vtkTextureObject.h>
 #include <vtkVersion.h>
-#include <vtkXMLMultiBlockDataReader.h>
 #include <vtk_glad.h>
 
 vtkStandardNewMacro(vtkF3DCachedSpecularTexture);
@@ -54,45 +53,39 @@ void vtkF3DCachedSpecularTexture::Load(vtkRenderer* ren)
 
     this->RenderWindow = renWin;
 
-    vtkNew<vtkXMLMultiBlockDataReader> reader;
-    reader->SetFileName(this->FileName.c_str());
-    reader->Update();
-
-    vtkMultiBlockDataSet* mb = vtkMultiBlockDataSet::SafeDownCast(reader->GetOutput());
+    F3DTextureCache cache;
+    if (!cache.Read(this->FileName) || cache.GetNumberOfFaces() != 6 ||
+      cache.GetNumberOfComponents() != 3 || cache.GetDataType() != VTK_FLOAT)
+    {
+      vtkErrorMacro("Cannot read specular cache file " << this->FileName);
+      return;
+    }
 
-    unsigned int nbLevels = mb->GetNumberOfBlocks();
+    unsigned int nbLevels = cache.GetNumberOfLevels();
 
     this->TextureObject->SetMaxLevel(static_cast<int>(nbLevels) - 1);
 
-    vtkImageData* firstImg = vtkImageData::SafeDownCast(mb->GetBlock(0));
-
     void* data[6];
-    for (int i = 0; i < 6; i++)
+    for (unsigned int i = 0; i < 6; i++)
     {
-      data[i] = firstImg->GetScalarPointer(0, 0, i);
+      data[i] = const_cast<void*>(cache.GetData(0, i));
     }
 
-    const int* firstDims = firstImg->GetDimensions();
-    if (firstDims[0] != firstDims[1])
-    {
-      vtkWarningMacro("Specular cache has unexpected dimensions");
-    }
-    this->PrefilterSize = firstDims[0];
+    this->PrefilterSize = cache.GetSize();
     this->TextureObject->CreateCubeFromRaw(
       this->PrefilterSize, this->PrefilterSize, 3, VTK_FLOAT, data);
 
     // the mip levels are manually uploaded because there is no abstraction in VTK
     for (unsigned int i = 1; i < nbLevels; i++)
     {
-      vtkImageData* img = vtkImageData::SafeDownCast(mb->GetBlock(i));
-      int* dims = img->GetDimensions();
+      GLsizei size = static_cast<GLsizei>(cache.GetSize(i));
 
-      for (int j = 0; j < 6; j++)
+      for (unsigned int j = 0; j < 6; j++)
       {
         glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + j, static_cast<GLint>(i),
-          this->TextureObject->GetInternalFormat(VTK_FLOAT, 3, false), static_cast<GLint>(dims[0]),
-          static_cast<GLint>(dims[1]), 0, this->TextureObject->GetFormat(VTK_FLOAT, 3, false),
-          this->TextureObject->GetDataType(VTK_FLOAT), img->GetScalarPointer(0, 0, j));
+          this->TextureObject->GetInternalFormat(VTK_FLOAT, 3, false), size, size, 0,
+          this->TextureObject->GetFormat(VTK_FLOAT, 3, false),
+          this->TextureObject->GetDataType(VTK_FLOAT), cache.GetData(i, j));
       }
     }
 
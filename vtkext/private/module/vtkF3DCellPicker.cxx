@@ -0,0 +1,74 @@
+#include "vtkF3DCellPicker.h"
+#include "vtkF3DImporter.h"
+#include <vtkAbstractMapper3D.h>
+#include <vtkInformation.h>
+#include <vtkInformationDoubleVectorKey.h>
+#include <vtkMath.h>
+#include <vtkMatrix3x3.h>
+#include <vtkMatrix4x4.h>
+#include <vtkObjectFactory.h>
+#include <vtkTransform.h>
+#include <algorithm>
+
+vtkStandardNewMacro(vtkF3DCellPicker);
+
+//----------------------------------------------------------------------------
+double vtkF3DCellPicker::IntersectWithLine(const double p1[3], const double p2[3], double tol,
+  vtkAssemblyPath* path, vtkProp3D* prop, vtkAbstractMapper3D* mapper)
+{
+  vtkInformation* info = mapper ? mapper->GetInformation() : nullptr;
+  int nbInstances = info ? info->Length(vtkF3DImporter::MAPPER_INSTANCE_MATRICES()) / 16 : 0;
+  if (nbInstances == 0)
+  {
+    return this->Superclass::IntersectWithLine(p1, p2, tol, path, prop, mapper);
+  }
+
+  // the parametric coordinate along the line does not depend on the instance matrix,
+  // so the closest instance is the one with the smallest coordinate
+  const double* matrices = info->Get(vtkF3DImporter::MAPPER_INSTANCE_MATRICES());
+  double tMin = VTK_DOUBLE_MAX;
+  for (int i = 0; i < nbInstances; i++)
+  {
+    const double* matrix = matrices + 16 * static_cast<size_t>(i);
+    double inverse[16];
+    vtkMatrix4x4::Invert(matrix, inverse);
+
+    const double p1Homogeneous[4] = { p1[0], p1[1], p1[2], 1.0 };
+    const double p2Homogeneous[4] = { p2[0], p2[1], p2[2], 1.0 };
+    double p1Instance[4];
+    double p2Instance[4];
+    vtkMatrix4x4::MultiplyPoint(inverse, p1Homogeneous, p1Instance);
+    vtkMatrix4x4::MultiplyPoint(inverse, p2Homogeneous, p2Instance);
+
+    double previousTMin = this->GlobalTMin;
+    double t = this->Superclass::IntersectWithLine(p1Instance, p2Instance, tol, path, prop, mapper);
+    tMin = std::min(tMin, t);
+
+    if (this->GlobalTMin < previousTMin)
+    {
+      // the superclass computed the position and the normal in the instance coordinates
+      const double instancePosition[4] = { this->MapperPosition[0], this->MapperPosition[1],
+        this->MapperPosition[2], 1.0 };
+      double position[4];
+      vtkMatrix4x4::MultiplyPoint(matrix, instancePosition, position);
+      std::copy(position, position + 3, this->MapperPosition);
+      this->Transform->TransformPoint(this->MapperPosition, this->PickPosition);
+
+      double normalMatrix[9];
+      for (int r = 0; r < 3; r++)
+      {
+        for (int c = 0; c < 3; c++)
+        {
+          normalMatrix[3 * r + c] = inverse[4 * c + r];
+        }
+      }
+      double normal[3];
+      vtkMatrix3x3::MultiplyPoint(normalMatrix, this->MapperNormal, normal);
+      vtkMath::Normalize(normal);
+      std::copy(normal, normal + 3, this->MapperNormal);
+      this->Transform->TransformNormal(this->MapperNormal, this->PickNormal);
+    }
+  }
+
+  return tMin;
+}
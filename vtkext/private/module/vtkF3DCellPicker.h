@@ -0,0 +1,35 @@
+/**
+ * @class   vtkF3DCellPicker
+ * @brief   Cell picker supporting instanced mappers
+ *
+ * Intersect the pick ray with each instance of mappers with
+ * vtkF3DImporter::MAPPER_INSTANCE_MATRICES set instead of only the instanced geometry.
+ */
+
+#ifndef vtkF3DCellPicker_h
+#define vtkF3DCellPicker_h
+
+#include <vtkCellPicker.h>
+
+class vtkF3DCellPicker : public vtkCellPicker
+{
+public:
+  static vtkF3DCellPicker* New();
+  vtkTypeMacro(vtkF3DCellPicker, vtkCellPicker);
+
+protected:
+  vtkF3DCellPicker() = default;
+  ~vtkF3DCellPicker() override = default;
+
+  /**
+   * Intersect the line with all instances of the mapper, in the mapper coordinates
+   */
+  double IntersectWithLine(const double p1[3], const double p2[3], double tol,
+    vtkAssemblyPath* path, vtkProp3D* prop, vtkAbstractMapper3D* mapper) override;
+
+private:
+  vtkF3DCellPicker(const vtkF3DCellPicker&) = delete;
+  void operator=(const vtkF3DCellPicker&) = delete;
+};
+
+#endif
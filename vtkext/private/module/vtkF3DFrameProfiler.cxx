@@ -0,0 +1,190 @@
+#include "vtkF3DFrameProfiler.h"
+
+#include "vtkF3DRenderer.h"
+
+#include <vtkObjectFactory.h>
+#include <vtk_glad.h>
+
+#include <cassert>
+
+// Timestamp queries are not available with OpenGL ES
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+#define F3D_TIMESTAMP_QUERY_SUPPORTED 1
+#else
+#define F3D_TIMESTAMP_QUERY_SUPPORTED 0
+#endif
+
+vtkStandardNewMacro(vtkF3DFrameProfiler);
+
+//----------------------------------------------------------------------------
+void vtkF3DFrameProfiler::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Enabled: " << this->Enabled << "\n";
+  for (const Timing& timing : this->Timings)
+  {
+    os << indent << std::string(2 * timing.Depth, ' ') << timing.Name << ": "
+       << timing.Time * 1e3 << " ms\n";
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DFrameProfiler::StartFrame()
+{
+  assert(!this->InFrame);
+  if (!this->Enabled)
+  {
+    return false;
+  }
+
+  // The oldest frame of the ring is reused for the new frame
+  this->CurrentFrame = (this->CurrentFrame + 1) % RING_SIZE;
+  Frame& frame = this->Frames[this->CurrentFrame];
+
+  bool newTimings = false;
+  if (frame.Pending)
+  {
+    newTimings = this->ReadBack();
+  }
+
+  frame.UsedQueries = 0;
+  frame.Records.clear();
+  frame.Pending = false;
+  this->OpenScopes.clear();
+  this->InFrame = true;
+  return newTimings;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DFrameProfiler::EndFrame()
+{
+  if (!this->InFrame)
+  {
+    return;
+  }
+
+  while (!this->OpenScopes.empty())
+  {
+    this->EndScope();
+  }
+
+  Frame& frame = this->Frames[this->CurrentFrame];
+  frame.Pending = !frame.Records.empty();
+  this->InFrame = false;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DFrameProfiler::StartScope(const std::string& name)
+{
+  if (!this->InFrame)
+  {
+    return;
+  }
+
+  Frame& frame = this->Frames[this->CurrentFrame];
+  Record record{ name, static_cast<int>(this->OpenScopes.size()), this->GetQuery(), 0 };
+#if F3D_TIMESTAMP_QUERY_SUPPORTED
+  glQueryCounter(record.StartQuery, GL_TIMESTAMP);
+#endif
+  this->OpenScopes.push_back(frame.Records.size());
+  frame.Records.emplace_back(std::move(record));
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DFrameProfiler::EndScope()
+{
+  if (!this->InFrame || this->OpenScopes.empty())
+  {
+    return;
+  }
+
+  Frame& frame = this->Frames[this->CurrentFrame];
+  Record& record = frame.Records[this->OpenScopes.back()];
+  this->OpenScopes.pop_back();
+  record.EndQuery = this->GetQuery();
+#if F3D_TIMESTAMP_QUERY_SUPPORTED
+  glQueryCounter(record.EndQuery, GL_TIMESTAMP);
+#endif
+}
+
+//----------------------------------------------------------------------------
+unsigned int vtkF3DFrameProfiler::GetQuery()
+{
+  Frame& frame = this->Frames[this->CurrentFrame];
+  if (frame.UsedQueries == frame.Queries.size())
+  {
+    unsigned int query = 0;
+#if F3D_TIMESTAMP_QUERY_SUPPORTED
+    glGenQueries(1, &query);
+#endif
+    frame.Queries.push_back(query);
+  }
+  return frame.Queries[frame.UsedQueries++];
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DFrameProfiler::ReadBack()
+{
+#if F3D_TIMESTAMP_QUERY_SUPPORTED
+  const Frame& frame = this->Frames[this->CurrentFrame];
+
+  // Timestamps are written in order, if the last one is available all of them are.
+  // If the GPU is still behind, the results are dropped rather than waited for.
+  GLint available = 0;
+  glGetQueryObjectiv(frame.Queries[frame.UsedQueries - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+  if (!available)
+  {
+    return false;
+  }
+
+  this->Timings.clear();
+  for (const Record& record : frame.Records)
+  {
+    GLuint64 start = 0;
+    GLuint64 end = 0;
+    glGetQueryObjectui64v(record.StartQuery, GL_QUERY_RESULT, &start);
+    glGetQueryObjectui64v(record.EndQuery, GL_QUERY_RESULT, &end);
+    this->Timings.push_back({ record.Name, record.Depth, (end - start) * 1e-9 });
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DFrameProfiler::ReleaseGraphicsResources()
+{
+  for (Frame& frame : this->Frames)
+  {
+#if F3D_TIMESTAMP_QUERY_SUPPORTED
+    if (!frame.Queries.empty())
+    {
+      glDeleteQueries(static_cast<GLsizei>(frame.Queries.size()), frame.Queries.data());
+    }
+#endif
+    frame = Frame();
+  }
+  this->OpenScopes.clear();
+  this->InFrame = false;
+}
+
+//----------------------------------------------------------------------------
+vtkF3DFrameProfiler::Scope::Scope(vtkRenderer* renderer, const std::string& name)
+{
+  vtkF3DRenderer* ren = vtkF3DRenderer::SafeDownCast(renderer);
+  if (ren && ren->GetFrameProfiler()->GetEnabled())
+  {
+    this->Profiler = ren->GetFrameProfiler();
+    this->Profiler->StartScope(name);
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkF3DFrameProfiler::Scope::~Scope()
+{
+  if (this->Profiler)
+  {
+    this->Profiler->EndScope();
+  }
+}
@@ -0,0 +1,137 @@
+/**
+ * @class   vtkF3DFrameProfiler
+ * @brief   Measure the GPU time of the stages of a frame without stalling
+ *
+ * This class records OpenGL timestamp queries around named scopes of a frame.
+ * Queries are stored in a ring of frames and read back a few frames later, only if the GPU
+ * already provided the results, so that the CPU never waits for the GPU to finish a frame.
+ * The latest available timings can be retrieved with GetTimings.
+ * Scopes can be nested, the depth of each scope is provided with its timing.
+ * Scopes started outside of a frame, or when the profiler is disabled, are ignored.
+ * Timestamp queries are not supported with OpenGL ES, in that case nothing is measured.
+ */
+
+#ifndef vtkF3DFrameProfiler_h
+#define vtkF3DFrameProfiler_h
+
+#include <vtkObject.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+class vtkRenderer;
+
+class vtkF3DFrameProfiler : public vtkObject
+{
+public:
+  static vtkF3DFrameProfiler* New();
+  vtkTypeMacro(vtkF3DFrameProfiler, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Number of frames in flight before the queries of a frame are read back
+   */
+  static constexpr int RING_SIZE = 4;
+
+  struct Timing
+  {
+    std::string Name;
+    int Depth;
+    double Time; // in seconds
+  };
+
+  ///@{
+  /**
+   * Enable/Disable the profiler. Disabled by default.
+   */
+  vtkSetMacro(Enabled, bool);
+  vtkGetMacro(Enabled, bool);
+  vtkBooleanMacro(Enabled, bool);
+  ///@}
+
+  /**
+   * Start a new frame, reading back the results of the oldest frame of the ring if the GPU
+   * already provided them.
+   * Return true if new timings are available.
+   */
+  bool StartFrame();
+
+  /**
+   * End the current frame
+   */
+  void EndFrame();
+
+  ///@{
+  /**
+   * Start/End a named scope in the current frame. Scopes must be ended in reverse order.
+   */
+  void StartScope(const std::string& name);
+  void EndScope();
+  ///@}
+
+  /**
+   * Get the timings of the latest frame read back, in the order the scopes were started.
+   */
+  const std::vector<Timing>& GetTimings() const
+  {
+    return this->Timings;
+  }
+
+  /**
+   * Release the queries, must be called while the OpenGL context is current.
+   */
+  void ReleaseGraphicsResources();
+
+  /**
+   * Scope guard timing the enclosed code with the profiler of the provided renderer,
+   * if it is a vtkF3DRenderer. Does nothing otherwise.
+   */
+  class Scope
+  {
+  public:
+    Scope(vtkRenderer* renderer, const std::string& name);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    vtkF3DFrameProfiler* Profiler = nullptr;
+  };
+
+protected:
+  vtkF3DFrameProfiler() = default;
+  ~vtkF3DFrameProfiler() override = default;
+
+private:
+  vtkF3DFrameProfiler(const vtkF3DFrameProfiler&) = delete;
+  void operator=(const vtkF3DFrameProfiler&) = delete;
+
+  unsigned int GetQuery();
+  bool ReadBack();
+
+  struct Record
+  {
+    std::string Name;
+    int Depth;
+    unsigned int StartQuery;
+    unsigned int EndQuery;
+  };
+
+  struct Frame
+  {
+    std::vector<unsigned int> Queries;
+    size_t UsedQueries = 0;
+    std::vector<Record> Records;
+    bool Pending = false;
+  };
+
+  bool Enabled = false;
+  bool InFrame = false;
+  int CurrentFrame = 0;
+  std::array<Frame, RING_SIZE> Frames;
+  std::vector<size_t> OpenScopes;
+  std::vector<Timing> Timings;
+};
+
+#endif
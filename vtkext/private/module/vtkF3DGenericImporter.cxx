@@ -1,15 +1,20 @@
 #include "vtkF3DGenericImporter.h"
 
 #include "F3DLog.h"
+#include "F3DTrace.h"
 #include "vtkF3DPostProcessFilter.h"
 
 #include <vtkActor.h>
 #include <vtkCompositeDataIterator.h>
+#include <vtkDataArraySelection.h>
 #include <vtkDataAssembly.h>
 #include <vtkDoubleArray.h>
 #include <vtkEventForwarderCommand.h>
 #include <vtkImageData.h>
 #include <vtkInformation.h>
+#include <vtkInformationDoubleVectorKey.h>
+#include <vtkInformationObjectBaseKey.h>
+#include <vtkMatrix4x4.h>
 #include <vtkMultiBlockDataSet.h>
 #include <vtkObjectFactory.h>
 #include <vtkPartitionedDataSet.h>
@@ -42,6 +47,9 @@ struct vtkF3DGenericImporter::Internals
   std::vector<BlockData> Blocks;
   std::string OutputDescription;
 
+  bool ReaderUpdated = false;
+  vtkMTimeType ReaderUpdateMTime = 0;
+
   bool HasAnimation = false;
   bool AnimationEnabled = false;
   std::array<double, 2> TimeRange;
@@ -49,6 +57,7 @@ struct vtkF3DGenericImporter::Internals
 
   void UpdateBlock(BlockData& bd, vtkDataSet* dataset)
   {
+    F3DTrace::Scope trace("post process", "load");
     bd.PostPro->SetInputDataObject(dataset);
     bd.PostPro->Update();
     bd.Points = vtkPolyData::SafeDownCast(bd.PostPro->GetOutput(1));
@@ -158,8 +167,8 @@ bool vtkF3DGenericImporter::GetTemporalInformation([[maybe_unused]] vtkIdType an
 }
 
 //----------------------------------------------------------------------------
-void vtkF3DGenericImporter::CreateActorForBlock(
-  int nodeid, vtkDataSet* block, vtkRenderer* ren, const std::string& blockName)
+void vtkF3DGenericImporter::CreateActorForBlock(int nodeid, vtkDataSet* block, vtkRenderer* ren,
+  const std::string& blockName, vtkInformation* blockMetaData)
 {
   this->Pimpl->Blocks.emplace_back();
   Internals::BlockData& bd = this->Pimpl->Blocks.back();
@@ -188,6 +197,13 @@ void vtkF3DGenericImporter::CreateActorForBlock(
   bd.Actor->GetProperty()->SetColor(0.65, 0.65, 0.65);
   bd.Actor->GetProperty()->SetInterpolationToPBR();
 
+  if (blockMetaData && blockMetaData->Length(vtkF3DImporter::BLOCK_USER_MATRIX()) == 16)
+  {
+    vtkNew<vtkMatrix4x4> matrix;
+    matrix->DeepCopy(blockMetaData->Get(vtkF3DImporter::BLOCK_USER_MATRIX()));
+    bd.Actor->SetUserMatrix(matrix);
+  }
+
   ren->AddActor(bd.Actor);
   this->ActorCollection->AddItem(bd.Actor);
 
@@ -209,7 +225,13 @@ void vtkF3DGenericImporter::ImportActors(vtkRenderer* ren)
   vtkNew<vtkEventForwarderCommand> progressForwarder;
   progressForwarder->SetTarget(this);
   this->Pimpl->Reader->AddObserver(vtkCommand::ProgressEvent, progressForwarder);
-  bool status = this->Pimpl->Reader->GetExecutive()->Update();
+  bool status;
+  {
+    F3DTrace::Scope trace("read", this->Pimpl->Reader->GetClassName(), "load");
+    status = this->Pimpl->Reader->GetExecutive()->Update();
+  }
+  this->Pimpl->ReaderUpdated = true;
+  this->Pimpl->ReaderUpdateMTime = this->Pimpl->Reader->GetMTime();
 
   vtkDataObject* output = this->Pimpl->Reader->GetOutputDataObject(0);
   if (!status || !output)
@@ -378,12 +400,23 @@ bool vtkF3DGenericImporter::UpdateAtTimeValue(double timeValue)
 
   vtkInformation* info = this->Pimpl->Reader->GetOutputInformation(0);
   info->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), timeValue);
+  if (!this->UpdateBlocks())
+  {
+    F3DLog::Print(F3DLog::Severity::Warning, "A reader failed to update at a timeValue");
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DGenericImporter::UpdateBlocks()
+{
   bool status = this->Pimpl->Reader->GetExecutive()->Update();
+  this->Pimpl->ReaderUpdateMTime = this->Pimpl->Reader->GetMTime();
 
   vtkDataObject* output = this->Pimpl->Reader->GetOutputDataObject(0);
   if (!status || !output)
   {
-    F3DLog::Print(F3DLog::Severity::Warning, "A reader failed to update at a timeValue");
     return false;
   }
 
@@ -541,7 +574,8 @@ void vtkF3DGenericImporter::ImportMultiBlock(int nodeid, vtkMultiBlockDataSet* m
     }
     else if (ds)
     {
-      this->CreateActorForBlock(nodeid, ds, ren, blockName);
+      this->CreateActorForBlock(
+        nodeid, ds, ren, blockName, mb->HasMetaData(i) ? mb->GetMetaData(i) : nullptr);
     }
   }
 }
@@ -644,3 +678,82 @@ void vtkF3DGenericImporter::ImportPartitionedDataSet(
     this->CreateActorForBlock(vtkDataAssembly::GetRootNode(), ds, ren, blockName);
   }
 }
+
+//----------------------------------------------------------------------------
+bool vtkF3DGenericImporter::LoadDeferredArrays(const std::optional<std::string>& arrayName)
+{
+  assert(this->Pimpl->Reader);
+
+  vtkDataArraySelection* selection = vtkDataArraySelection::SafeDownCast(
+    this->Pimpl->Reader->GetInformation()->Get(vtkF3DImporter::READER_DEFERRED_ARRAYS()));
+  if (!selection)
+  {
+    return false;
+  }
+
+  bool loaded = false;
+  if (arrayName.has_value())
+  {
+    const char* name = arrayName.value().c_str();
+    if (selection->ArrayExists(name) && !selection->ArrayIsEnabled(name))
+    {
+      selection->EnableArray(name);
+      loaded = true;
+    }
+  }
+  else if (selection->GetNumberOfArraysEnabled() < selection->GetNumberOfArrays())
+  {
+    selection->EnableAllArrays();
+    loaded = true;
+  }
+
+  if (loaded && this->Pimpl->ReaderUpdated)
+  {
+    if (!this->UpdateBlocks())
+    {
+      F3DLog::Print(F3DLog::Severity::Warning, "A reader failed to load deferred arrays");
+      return false;
+    }
+  }
+  return loaded;
+}
+
+//----------------------------------------------------------------------------
+std::vector<std::string> vtkF3DGenericImporter::GetDeferredArrayNames()
+{
+  assert(this->Pimpl->Reader);
+
+  std::vector<std::string> names;
+  vtkDataArraySelection* selection = vtkDataArraySelection::SafeDownCast(
+    this->Pimpl->Reader->GetInformation()->Get(vtkF3DImporter::READER_DEFERRED_ARRAYS()));
+  if (selection)
+  {
+    for (int i = 0; i < selection->GetNumberOfArrays(); i++)
+    {
+      if (!selection->GetArraySetting(i))
+      {
+        names.emplace_back(selection->GetArrayName(i));
+      }
+    }
+  }
+  return names;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DGenericImporter::UpdateIfModified()
+{
+  assert(this->Pimpl->Reader);
+
+  if (!this->Pimpl->ReaderUpdated ||
+    this->Pimpl->Reader->GetMTime() <= this->Pimpl->ReaderUpdateMTime)
+  {
+    return false;
+  }
+
+  if (!this->UpdateBlocks())
+  {
+    F3DLog::Print(F3DLog::Severity::Warning, "A reader failed to update");
+    return false;
+  }
+  return true;
+}
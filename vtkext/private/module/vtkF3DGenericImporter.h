@@ -9,10 +9,14 @@
 #include "vtkF3DImporter.h"
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 class vtkAlgorithm;
 class vtkDataObject;
 class vtkImageData;
+class vtkInformation;
 class vtkMultiBlockDataSet;
 class vtkPartitionedDataSet;
 class vtkPartitionedDataSetCollection;
@@ -107,6 +111,28 @@ public:
    */
   vtkIdType GetNumberOfBlocks();
 
+  /**
+   * Load arrays that the internal reader does not read by default,
+   * see vtkF3DImporter::READER_DEFERRED_ARRAYS.
+   * If arrayName is provided, only this array is loaded, otherwise all deferred arrays are.
+   * If the reader was already updated, it is updated again and blocks are refreshed.
+   * Return true if an array was loaded.
+   */
+  bool LoadDeferredArrays(const std::optional<std::string>& arrayName);
+
+  /**
+   * Get the names of the deferred arrays that are not loaded yet,
+   * see vtkF3DImporter::READER_DEFERRED_ARRAYS.
+   */
+  std::vector<std::string> GetDeferredArrayNames();
+
+  /**
+   * Update the internal reader and refresh the blocks if the reader was modified since its last
+   * update, eg. when a streamed mesh received a new state.
+   * Return true if the blocks were refreshed.
+   */
+  bool UpdateIfModified();
+
 protected:
   vtkF3DGenericImporter();
   ~vtkF3DGenericImporter() override = default;
@@ -126,15 +152,21 @@ protected:
    */
   void UpdateOutputDescriptions();
 
+  /**
+   * Update the internal reader and refresh the blocks with its output
+   */
+  bool UpdateBlocks();
+
 private:
   vtkF3DGenericImporter(const vtkF3DGenericImporter&) = delete;
   void operator=(const vtkF3DGenericImporter&) = delete;
 
   /**
    * Create an actor for a single dataset block
+   * The actor is positioned with the BLOCK_USER_MATRIX of the block metadata, if any
    */
-  void CreateActorForBlock(
-    int nodeid, vtkDataSet* block, vtkRenderer* ren, const std::string& blockName = "");
+  void CreateActorForBlock(int nodeid, vtkDataSet* block, vtkRenderer* ren,
+    const std::string& blockName = "", vtkInformation* blockMetaData = nullptr);
 
   /**
    * Import blocks from a vtkMultiBlockDataSet with proper name extraction
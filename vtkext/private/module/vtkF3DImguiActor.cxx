@@ -471,6 +471,14 @@ void SetupNextWindow(std::optional<ImVec2> position, std::optional<ImVec2> size)
   }
 }
 
+// Format a duration in seconds as milliseconds with two decimals
+std::string FormatMilliseconds(double seconds)
+{
+  std::stringstream stream;
+  stream << std::fixed << std::setprecision(2) << seconds * 1e3 << " ms";
+  return stream.str();
+}
+
 // Painted thickness of the progress bar itself, independent of font scale.
 constexpr float PROGRESS_BAR_THICKNESS = 5.f;
 
@@ -1158,6 +1166,12 @@ void vtkF3DImguiActor::RenderFpsCounter()
   std::string fpsString = std::to_string(this->FpsValue);
   fpsString += " fps";
 
+  // GPU time breakdown of the frame, if available
+  for (const auto& [label, time] : this->FrameTimings)
+  {
+    fpsString += "\n" + label + ": " + ::FormatMilliseconds(time);
+  }
+
   ImVec2 winSize = ImGui::CalcTextSize(fpsString.c_str());
   winSize.x += 2.f * ImGui::GetStyle().WindowPadding.x;
   winSize.y += 2.f * ImGui::GetStyle().WindowPadding.y;
@@ -1442,6 +1456,16 @@ void vtkF3DImguiActor::SetDeltaTime(double time)
   io.DeltaTime = time;
 }
 
+//----------------------------------------------------------------------------
+bool vtkF3DImguiActor::IsAnimated() const
+{
+  if (this->Superclass::IsAnimated())
+  {
+    return true;
+  }
+  return ImGui::GetCurrentContext() != nullptr && ImGui::GetIO().WantCaptureMouse;
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DImguiActor::RenderNotifications(double currentTime)
 {
@@ -36,6 +36,11 @@ public:
    */
   void SetDeltaTime(double time) override;
 
+  /**
+   * Also consider the UI animated when hovered, for highlights and tooltips
+   */
+  bool IsAnimated() const override;
+
 protected:
   vtkF3DImguiActor();
   ~vtkF3DImguiActor() override;
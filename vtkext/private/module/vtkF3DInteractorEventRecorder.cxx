@@ -1,10 +1,98 @@
 #include "vtkF3DInteractorEventRecorder.h"
 
+#include "F3DLog.h"
+
 #include <vtkCallbackCommand.h>
 #include <vtkObjectFactory.h>
 #include <vtkRenderWindow.h>
 #include <vtkRenderWindowInteractor.h>
+#include <vtkStringArray.h>
 #include <vtkVersion.h>
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+
+namespace
+{
+// Magic header of the binary format, including its version
+constexpr char BinaryMagic[] = { 'F', '3', 'D', 'R', 'E', 'C', 1, '\n' };
+
+// Protect against corrupted files when reading strings
+constexpr uint64_t MaxStringLength = 1 << 20;
+
+//------------------------------------------------------------------------------
+void WriteVarint(std::ostream& stream, uint64_t value)
+{
+  while (value >= 0x80)
+  {
+    stream.put(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  stream.put(static_cast<char>(value));
+}
+
+//------------------------------------------------------------------------------
+bool ReadVarint(std::istream& stream, uint64_t& value)
+{
+  value = 0;
+  for (int shift = 0; shift < 64; shift += 7)
+  {
+    int byte = stream.get();
+    if (byte == std::istream::traits_type::eof())
+    {
+      return false;
+    }
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+//------------------------------------------------------------------------------
+// Signed values are zigzag encoded so that small negative values stay small
+void WriteSigned(std::ostream& stream, int64_t value)
+{
+  ::WriteVarint(stream, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+//------------------------------------------------------------------------------
+bool ReadSigned(std::istream& stream, int64_t& value)
+{
+  uint64_t encoded = 0;
+  if (!::ReadVarint(stream, encoded))
+  {
+    return false;
+  }
+  value = static_cast<int64_t>(encoded >> 1) ^ -static_cast<int64_t>(encoded & 1);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void WriteString(std::ostream& stream, const std::string& str)
+{
+  ::WriteVarint(stream, str.size());
+  stream.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+//------------------------------------------------------------------------------
+bool ReadString(std::istream& stream, std::string& str)
+{
+  uint64_t size = 0;
+  if (!::ReadVarint(stream, size) || size > ::MaxStringLength)
+  {
+    return false;
+  }
+  str.resize(static_cast<size_t>(size));
+  stream.read(str.data(), static_cast<std::streamsize>(size));
+  return stream.gcount() == static_cast<std::streamsize>(size);
+}
+}
 
 vtkStandardNewMacro(vtkF3DInteractorEventRecorder);
 
@@ -15,6 +103,15 @@ vtkF3DInteractorEventRecorder::vtkF3DInteractorEventRecorder()
   this->EventCallbackCommand->SetCallback(vtkF3DInteractorEventRecorder::ProcessEvents);
 }
 
+//------------------------------------------------------------------------------
+vtkF3DInteractorEventRecorder::~vtkF3DInteractorEventRecorder()
+{
+  if (this->Interactor)
+  {
+    this->Interactor->RemoveObserver(this->RenderObserverTag);
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkF3DInteractorEventRecorder::SetInteractor(vtkRenderWindowInteractor* interactor)
 {
@@ -27,6 +124,7 @@ void vtkF3DInteractorEventRecorder::SetInteractor(vtkRenderWindowInteractor* int
   if (this->Interactor)
   {
     this->SetEnabled(0); // disable the old interactor
+    this->Interactor->RemoveObserver(this->RenderObserverTag);
   }
 
   this->Interactor = interactor;
@@ -36,20 +134,331 @@ void vtkF3DInteractorEventRecorder::SetInteractor(vtkRenderWindowInteractor* int
     // Make sure RenderEvent triggers renders
     // TODO: Ideally, RenderEvent should be triggered from VTK side
     vtkNew<vtkCallbackCommand> renderCallback;
-    renderCallback->SetClientData(this->Interactor->GetRenderWindow());
+    renderCallback->SetClientData(this);
     renderCallback->SetCallback(
       [](vtkObject*, unsigned long, void* clientData, void*)
       {
-        vtkRenderWindow* window = static_cast<vtkRenderWindow*>(clientData);
-        window->Render();
+        vtkF3DInteractorEventRecorder* self =
+          static_cast<vtkF3DInteractorEventRecorder*>(clientData);
+
+        // When playing checkpoints only, the renders requested by the played events are skipped
+        if (self->CheckpointsOnly && self->State == vtkInteractorEventRecorder::Playing &&
+          !self->PlayingCheckpoint)
+        {
+          return;
+        }
+
+        vtkRenderWindow* window = self->Interactor->GetRenderWindow();
+        if (window)
+        {
+          window->Render();
+        }
       });
 
-    this->Interactor->AddObserver(vtkCommand::RenderEvent, renderCallback);
+    this->RenderObserverTag =
+      this->Interactor->AddObserver(vtkCommand::RenderEvent, renderCallback);
   }
 
   this->Modified();
 }
 
+//------------------------------------------------------------------------------
+void vtkF3DInteractorEventRecorder::Record()
+{
+  std::string fileName = this->FileName ? this->FileName : "";
+  this->Binary = vtksys::SystemTools::StringEndsWith(
+    fileName, vtkF3DInteractorEventRecorder::BINARY_EXTENSION);
+  if (!this->Binary || this->State != vtkInteractorEventRecorder::Start)
+  {
+    this->Superclass::Record();
+    return;
+  }
+
+  if (!this->OutputStream)
+  {
+    this->OutputStream = new vtksys::ofstream(fileName.c_str(), ios::out | ios::binary);
+    if (this->OutputStream->fail())
+    {
+      F3DLog::Print(F3DLog::Severity::Error, "Unable to open file: " + fileName);
+      delete this->OutputStream;
+      this->OutputStream = nullptr;
+      return;
+    }
+    this->OutputStream->write(::BinaryMagic, sizeof(::BinaryMagic));
+  }
+
+  this->EventNames.clear();
+  this->PreviousEvent = Event();
+  this->State = vtkInteractorEventRecorder::Recording;
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DInteractorEventRecorder::Play()
+{
+  if (this->State != vtkInteractorEventRecorder::Start || !this->Interactor || !this->FileName)
+  {
+    this->Superclass::Play();
+    return;
+  }
+
+  vtksys::ifstream stream(this->FileName, ios::in | ios::binary);
+  char magic[sizeof(::BinaryMagic)] = {};
+  stream.read(magic, sizeof(magic));
+  bool binary = stream.gcount() == sizeof(magic) &&
+    std::equal(std::begin(magic), std::end(magic), std::begin(::BinaryMagic));
+
+  // Text recordings are played by VTK unless only checkpoints should be rendered
+  if (!binary && !this->CheckpointsOnly)
+  {
+    stream.close();
+    this->Superclass::Play();
+    return;
+  }
+
+  if (!binary)
+  {
+    stream.clear();
+    stream.seekg(0);
+  }
+
+  this->EventNames.clear();
+  this->PreviousEvent = Event();
+  this->TextStreamVersion = 0;
+
+  bool enableRender = this->Interactor->GetEnableRender();
+  if (this->CheckpointsOnly)
+  {
+    this->Interactor->EnableRenderOff();
+  }
+
+  this->State = vtkInteractorEventRecorder::Playing;
+  Event event;
+  bool unsupported = false;
+  while (this->State == vtkInteractorEventRecorder::Playing && !this->Interactor->GetDone())
+  {
+    const ReadStatus status =
+      binary ? this->ReadBinaryEvent(stream, event) : this->ReadTextEvent(stream, event);
+    if (status != ReadStatus::Success)
+    {
+      if (status == ReadStatus::Failure && !stream.eof())
+      {
+        F3DLog::Print(F3DLog::Severity::Warning,
+          "Invalid interaction recording, stopped playing " + std::string(this->FileName));
+      }
+      unsupported = status == ReadStatus::Unsupported;
+      break;
+    }
+    this->InvokeRecordedEvent(event);
+  }
+  this->State = vtkInteractorEventRecorder::Start;
+
+  this->Interactor->SetEnableRender(enableRender);
+
+  // Recordings that cannot be read here are played by VTK, rendering all events
+  if (unsupported)
+  {
+    stream.close();
+    this->CheckpointsOnly = false;
+    this->Superclass::Play();
+    this->CheckpointsOnly = true;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DInteractorEventRecorder::WriteBinaryEvent(const Event& event)
+{
+  std::ostream& stream = *this->OutputStream;
+  const Event& previous = this->PreviousEvent;
+
+  // Consecutive identical events, eg: timer events, are stored as a single byte
+  if (event.Data.empty() && previous.Data.empty() && event.Name == previous.Name &&
+    event.Position[0] == previous.Position[0] && event.Position[1] == previous.Position[1] &&
+    event.Modifiers == previous.Modifiers && event.KeyCode == previous.KeyCode &&
+    event.RepeatCount == previous.RepeatCount && event.KeySym == previous.KeySym)
+  {
+    ::WriteVarint(stream, 0);
+    return;
+  }
+
+  // Event names are stored once, then referred to by their index, shifted by one
+  auto it = std::find(this->EventNames.begin(), this->EventNames.end(), event.Name);
+  ::WriteVarint(stream, static_cast<uint64_t>(std::distance(this->EventNames.begin(), it)) + 1);
+  if (it == this->EventNames.end())
+  {
+    ::WriteString(stream, event.Name);
+    this->EventNames.emplace_back(event.Name);
+  }
+
+  ::WriteSigned(stream, event.Position[0] - previous.Position[0]);
+  ::WriteSigned(stream, event.Position[1] - previous.Position[1]);
+  ::WriteVarint(stream, static_cast<uint64_t>(event.Modifiers));
+  ::WriteVarint(stream, static_cast<unsigned char>(event.KeyCode));
+  ::WriteVarint(stream, static_cast<uint64_t>(event.RepeatCount));
+  ::WriteString(stream, event.KeySym);
+  ::WriteVarint(stream, event.Data.size());
+  for (const std::string& str : event.Data)
+  {
+    ::WriteString(stream, str);
+  }
+
+  this->PreviousEvent = event;
+}
+
+//------------------------------------------------------------------------------
+vtkF3DInteractorEventRecorder::ReadStatus vtkF3DInteractorEventRecorder::ReadBinaryEvent(
+  std::istream& stream, Event& event)
+{
+  uint64_t index = 0;
+  if (!::ReadVarint(stream, index))
+  {
+    return ReadStatus::Failure;
+  }
+
+  if (index == 0)
+  {
+    event = this->PreviousEvent;
+    return ReadStatus::Success;
+  }
+
+  index--;
+  if (index > this->EventNames.size())
+  {
+    return ReadStatus::Failure;
+  }
+  if (index == this->EventNames.size())
+  {
+    std::string name;
+    if (!::ReadString(stream, name))
+    {
+      return ReadStatus::Failure;
+    }
+    this->EventNames.emplace_back(name);
+  }
+  event.Name = this->EventNames[index];
+
+  int64_t dx = 0;
+  int64_t dy = 0;
+  uint64_t modifiers = 0;
+  uint64_t keyCode = 0;
+  uint64_t repeatCount = 0;
+  uint64_t dataCount = 0;
+  if (!::ReadSigned(stream, dx) || !::ReadSigned(stream, dy) ||
+    !::ReadVarint(stream, modifiers) || !::ReadVarint(stream, keyCode) ||
+    !::ReadVarint(stream, repeatCount) || !::ReadString(stream, event.KeySym) ||
+    !::ReadVarint(stream, dataCount) || dataCount > ::MaxStringLength)
+  {
+    return ReadStatus::Failure;
+  }
+  event.Position[0] = this->PreviousEvent.Position[0] + static_cast<int>(dx);
+  event.Position[1] = this->PreviousEvent.Position[1] + static_cast<int>(dy);
+  event.Modifiers = static_cast<int>(modifiers);
+  event.KeyCode = static_cast<char>(keyCode);
+  event.RepeatCount = static_cast<int>(repeatCount);
+
+  event.Data.resize(static_cast<size_t>(dataCount));
+  for (std::string& str : event.Data)
+  {
+    if (!::ReadString(stream, str))
+    {
+      return ReadStatus::Failure;
+    }
+  }
+
+  this->PreviousEvent = event;
+  return ReadStatus::Success;
+}
+
+//------------------------------------------------------------------------------
+vtkF3DInteractorEventRecorder::ReadStatus vtkF3DInteractorEventRecorder::ReadTextEvent(
+  std::istream& stream, Event& event)
+{
+  std::string line;
+  while (std::getline(stream, line))
+  {
+    if (line.empty())
+    {
+      continue;
+    }
+
+    if (line[0] == '#')
+    {
+      // Only the stream version is specified in comments
+      std::istringstream iss(line.substr(1));
+      std::string key;
+      iss >> key;
+      if (key == "StreamVersion")
+      {
+        iss >> this->TextStreamVersion;
+      }
+      continue;
+    }
+
+    // Older versions store the modifiers differently
+    if (this->TextStreamVersion < 1.1)
+    {
+      F3DLog::Print(F3DLog::Severity::Warning,
+        "Playing checkpoints only requires an interaction recording version 1.1 or newer, "
+        "playing all renders instead");
+      return ReadStatus::Unsupported;
+    }
+
+    event = Event();
+    int keyCode = 0;
+    std::istringstream iss(line);
+    iss >> event.Name >> event.Position[0] >> event.Position[1] >> event.Modifiers >> keyCode >>
+      event.RepeatCount >> event.KeySym;
+    event.KeyCode = static_cast<char>(keyCode);
+
+    // The call data, only used for dropped files, was added in version 1.2
+    int dataType = 0;
+    if (this->TextStreamVersion >= 1.2 && (iss >> dataType) && dataType != 0)
+    {
+      size_t count = 0;
+      iss >> count;
+      event.Data.resize(count);
+      for (std::string& str : event.Data)
+      {
+        iss >> str;
+      }
+    }
+    return iss.fail() ? ReadStatus::Failure : ReadStatus::Success;
+  }
+  return ReadStatus::Failure;
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DInteractorEventRecorder::InvokeRecordedEvent(const Event& event)
+{
+  unsigned long eventId = vtkCommand::GetEventIdFromString(event.Name.c_str());
+  if (eventId == vtkCommand::NoEvent)
+  {
+    return;
+  }
+
+  vtkRenderWindowInteractor* rwi = this->Interactor;
+  rwi->SetEventInformation(event.Position[0], event.Position[1],
+    (event.Modifiers & ModifierKey::ControlKey) ? 1 : 0,
+    (event.Modifiers & ModifierKey::ShiftKey) ? 1 : 0, event.KeyCode, event.RepeatCount,
+    event.KeySym.c_str());
+  rwi->SetAltKey((event.Modifiers & ModifierKey::AltKey) ? 1 : 0);
+
+  this->PlayingCheckpoint = eventId == vtkCommand::RenderEvent;
+  if (event.Data.empty())
+  {
+    rwi->InvokeEvent(eventId, nullptr);
+  }
+  else
+  {
+    vtkNew<vtkStringArray> data;
+    for (const std::string& str : event.Data)
+    {
+      data->InsertNextValue(str);
+    }
+    rwi->InvokeEvent(eventId, data);
+  }
+  this->PlayingCheckpoint = false;
+}
+
 //------------------------------------------------------------------------------
 void vtkF3DInteractorEventRecorder::ProcessEvents(
   vtkObject* object, unsigned long event, void* clientData, void* callData)
@@ -86,8 +495,32 @@ void vtkF3DInteractorEventRecorder::ProcessEvents(
         {
           mod |= ModifierKey::AltKey;
         }
-        self->WriteEvent(vtkCommand::GetStringFromEventId(event), rwi->GetEventPosition(), mod,
-          rwi->GetKeyCode(), rwi->GetRepeatCount(), rwi->GetKeySym(), callData);
+
+        if (self->Binary)
+        {
+          Event recorded;
+          recorded.Name = vtkCommand::GetStringFromEventId(event);
+          rwi->GetEventPosition(recorded.Position);
+          recorded.Modifiers = mod;
+          recorded.KeyCode = rwi->GetKeyCode();
+          recorded.RepeatCount = rwi->GetRepeatCount();
+          // A null key sym is stored as 0, as VTK does in the text format
+          recorded.KeySym = rwi->GetKeySym() ? rwi->GetKeySym() : "0";
+          if (event == vtkCommand::DropFilesEvent && callData)
+          {
+            vtkStringArray* files = static_cast<vtkStringArray*>(callData);
+            for (vtkIdType i = 0; i < files->GetNumberOfValues(); i++)
+            {
+              recorded.Data.emplace_back(files->GetValue(i));
+            }
+          }
+          self->WriteBinaryEvent(recorded);
+        }
+        else
+        {
+          self->WriteEvent(vtkCommand::GetStringFromEventId(event), rwi->GetEventPosition(), mod,
+            rwi->GetKeyCode(), rwi->GetRepeatCount(), rwi->GetKeySym(), callData);
+        }
 
         self->OutputStream->flush();
       }
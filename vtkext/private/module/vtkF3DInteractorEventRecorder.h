@@ -1,6 +1,17 @@
 /**
  * @class   vtkF3DInteractorEventRecorder
  * @brief   A F3D dedicated version of the vtkInteractorEventRecorder
+ *
+ * On top of the VTK text format, this recorder supports a compact binary format,
+ * used when recording into a file with the BINARY_EXTENSION extension and detected
+ * from the file content when playing.
+ * Each event is stored as an index in a table of event names, the position relative to the
+ * previous event and variable length integers, while an event identical to the previous one,
+ * eg: a timer event, is stored as a single byte.
+ *
+ * When CheckpointsOnly is enabled, the renders requested while playing are skipped,
+ * only the recorded RenderEvent, considered as checkpoints, trigger a render.
+ * Text recordings older than version 1.1 are played by VTK with all renders instead.
  * @sa vtkInteractorEventRecorder
  */
 
@@ -9,26 +20,94 @@
 
 #include <vtkInteractorEventRecorder.h>
 
+#include <istream>
+#include <string>
+#include <vector>
+
 class vtkF3DInteractorEventRecorder : public vtkInteractorEventRecorder
 {
 public:
   static vtkF3DInteractorEventRecorder* New();
   vtkTypeMacro(vtkF3DInteractorEventRecorder, vtkInteractorEventRecorder);
 
+  /**
+   * Extension of the files recorded using the binary format
+   */
+  static constexpr const char* BINARY_EXTENSION = ".f3drec";
+
   /*
    * Just set the interactor without adding other dedicated observers.
    */
   void SetInteractor(vtkRenderWindowInteractor* iren) override;
 
+  /**
+   * Record the events in the file, using the binary format if the file name ends
+   * with BINARY_EXTENSION, the VTK text format otherwise.
+   */
+  void Record() override;
+
+  /**
+   * Play the events of the file, in the binary or the VTK text format.
+   */
+  void Play() override;
+
+  ///@{
+  /**
+   * Set/Get if only the recorded RenderEvent trigger a render when playing.
+   * Other renders are skipped by disabling the interactor rendering while playing,
+   * so that events are processed as fast as possible.
+   * Only supported with the binary format and VTK text format 1.1 or newer.
+   * Default is false.
+   */
+  vtkSetMacro(CheckpointsOnly, bool);
+  vtkGetMacro(CheckpointsOnly, bool);
+  vtkBooleanMacro(CheckpointsOnly, bool);
+  ///@}
+
   vtkF3DInteractorEventRecorder(const vtkF3DInteractorEventRecorder&) = delete;
   void operator=(const vtkF3DInteractorEventRecorder&) = delete;
 
 protected:
   vtkF3DInteractorEventRecorder();
-  ~vtkF3DInteractorEventRecorder() override = default;
+  ~vtkF3DInteractorEventRecorder() override;
 
   static void ProcessEvents(
     vtkObject* object, unsigned long event, void* clientdata, void* calldata);
+
+private:
+  struct Event
+  {
+    std::string Name;
+    int Position[2] = { 0, 0 };
+    int Modifiers = 0;
+    char KeyCode = 0;
+    int RepeatCount = 0;
+    std::string KeySym;
+    std::vector<std::string> Data;
+  };
+
+  // Unsupported is used when the recording can only be played by VTK, already reported
+  enum class ReadStatus
+  {
+    Success,
+    Failure,
+    Unsupported
+  };
+
+  void WriteBinaryEvent(const Event& event);
+  ReadStatus ReadBinaryEvent(std::istream& stream, Event& event);
+  ReadStatus ReadTextEvent(std::istream& stream, Event& event);
+  void InvokeRecordedEvent(const Event& event);
+
+  unsigned long RenderObserverTag = 0;
+  bool Binary = false;
+  bool CheckpointsOnly = false;
+  bool PlayingCheckpoint = false;
+
+  // Binary format state, shared by recording and playing
+  std::vector<std::string> EventNames;
+  Event PreviousEvent;
+  double TextStreamVersion = 0;
 };
 
 #endif /* vtkF3DInteractorEventRecorder_h */
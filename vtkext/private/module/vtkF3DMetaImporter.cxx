@@ -1,6 +1,7 @@
 #include "vtkF3DMetaImporter.h"
 
 #include "F3DLog.h"
+#include "F3DTrace.h"
 #include "vtkF3DGenericImporter.h"
 #include "vtkF3DImporter.h"
 
@@ -8,22 +9,34 @@
 #include <vtkArrowSource.h>
 #include <vtkCallbackCommand.h>
 #include <vtkCamera.h>
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
 #include <vtkDataAssemblyVisitor.h>
 #include <vtkDataSetAttributes.h>
 #include <vtkImageData.h>
+#include <vtkInformation.h>
+#include <vtkInformationDoubleVectorKey.h>
 #include <vtkInformationIntegerKey.h>
+#include <vtkLight.h>
+#include <vtkLightCollection.h>
 #include <vtkObjectFactory.h>
 #include <vtkPointData.h>
+#include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkRenderWindow.h>
 #include <vtkRendererCollection.h>
 #include <vtkSmartPointer.h>
 #include <vtkTexture.h>
 #include <vtkVersion.h>
+#include <vtksys/SystemTools.hxx>
 
+#include <algorithm>
 #include <cassert>
+#include <cstdio>
 #include <iostream>
 #include <numeric>
+#include <set>
+#include <unordered_map>
 #include <vector>
 
 namespace
@@ -106,6 +119,183 @@ protected:
   }
 };
 vtkStandardNewMacro(vtkF3DCollapseOnLoadVisitor);
+
+//----------------------------------------------------------------------------
+// Add the bounds of an actor with a poly data mapper to the bounding box.
+// Generic importers position their blocks with the actor user matrix, which is only taken
+// into account when useUserMatrix is true, other importers bake it in the geometry.
+void AddActorBounds(vtkBoundingBox& bbox, vtkActor* actor, bool useUserMatrix)
+{
+  vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
+  double bounds[6];
+  if (useUserMatrix && actor->GetUserMatrix())
+  {
+    // Actor bounds are the mapper bounds transformed by the user matrix
+    actor->GetBounds(bounds);
+  }
+  else if (pdMapper->GetInformation()->Has(vtkF3DImporter::MAPPER_INSTANCE_MATRICES()))
+  {
+    // Instanced mapper bounds include all instances
+    pdMapper->GetBounds(bounds);
+  }
+  else
+  {
+    pdMapper->GetInput()->GetBounds(bounds);
+  }
+  bbox.AddBounds(bounds);
+}
+
+//----------------------------------------------------------------------------
+// Estimated GPU bytes per point of the auxiliary actors: a 4x4 matrix, a 3x3 normal matrix
+// and a color for each normal glyph, a position, a color, a scale and an opacity for each sprite
+constexpr vtkIdType NORMAL_GLYPH_BYTES = 16 * 4 + 9 * 4 + 4;
+constexpr vtkIdType POINT_SPRITE_BYTES = 3 * 4 + 4 + 4 + 4;
+
+//----------------------------------------------------------------------------
+// Size of an array in bytes, or 0 if it has already been accounted for
+vtkIdType GetArrayBytes(vtkAbstractArray* array, std::set<vtkAbstractArray*>& accounted)
+{
+  if (!array || !accounted.insert(array).second)
+  {
+    return 0;
+  }
+  if (vtkDataArray* dataArray = vtkDataArray::SafeDownCast(array))
+  {
+    return dataArray->GetDataSize() * dataArray->GetDataTypeSize();
+  }
+  // String and variant arrays, the actual memory size is in KiB
+  return static_cast<vtkIdType>(array->GetActualMemorySize()) * 1024;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType GetFieldDataBytes(vtkFieldData* fieldData, std::set<vtkAbstractArray*>& accounted)
+{
+  vtkIdType bytes = 0;
+  for (int i = 0; fieldData && i < fieldData->GetNumberOfArrays(); i++)
+  {
+    bytes += ::GetArrayBytes(fieldData->GetAbstractArray(i), accounted);
+  }
+  return bytes;
+}
+
+//----------------------------------------------------------------------------
+// Size of the points, cells and attributes of a dataset in bytes, ignoring accounted arrays
+vtkIdType GetDataSetBytes(vtkDataSet* dataSet, std::set<vtkAbstractArray*>& accounted)
+{
+  if (!dataSet)
+  {
+    return 0;
+  }
+
+  vtkIdType bytes = ::GetFieldDataBytes(dataSet->GetPointData(), accounted) +
+    ::GetFieldDataBytes(dataSet->GetCellData(), accounted) +
+    ::GetFieldDataBytes(dataSet->GetFieldData(), accounted);
+
+  vtkPointSet* pointSet = vtkPointSet::SafeDownCast(dataSet);
+  if (pointSet && pointSet->GetPoints())
+  {
+    bytes += ::GetArrayBytes(pointSet->GetPoints()->GetData(), accounted);
+  }
+
+  if (vtkPolyData* polyData = vtkPolyData::SafeDownCast(dataSet))
+  {
+    for (vtkCellArray* cells :
+      { polyData->GetVerts(), polyData->GetLines(), polyData->GetPolys(), polyData->GetStrips() })
+    {
+      bytes += ::GetArrayBytes(cells->GetOffsetsArray(), accounted);
+      bytes += ::GetArrayBytes(cells->GetConnectivityArray(), accounted);
+    }
+  }
+  return bytes;
+}
+
+//----------------------------------------------------------------------------
+// Estimated size in bytes of the vertex and index buffers of a surface: float positions,
+// normals, tangents and texture coordinates, 4 bytes colors and an unsigned int index
+// per vertex of the points, line segments and triangles
+vtkIdType EstimateGeometryBytes(vtkPolyData* surface)
+{
+  constexpr vtkIdType floatBytes = sizeof(float);
+  constexpr vtkIdType indexBytes = sizeof(unsigned int);
+
+  vtkPointData* pointData = surface->GetPointData();
+  vtkIdType bytesPerPoint = 3 * floatBytes;
+  for (vtkDataArray* array :
+    { pointData->GetNormals(), pointData->GetTangents(), pointData->GetTCoords() })
+  {
+    if (array)
+    {
+      bytesPerPoint += array->GetNumberOfComponents() * floatBytes;
+    }
+  }
+  if (pointData->GetScalars())
+  {
+    bytesPerPoint += 4;
+  }
+
+  vtkCellArray* lines = surface->GetLines();
+  vtkIdType indices = surface->GetVerts()->GetNumberOfConnectivityIds() +
+    2 * (lines->GetNumberOfConnectivityIds() - lines->GetNumberOfCells());
+  for (vtkCellArray* cells : { surface->GetPolys(), surface->GetStrips() })
+  {
+    vtkIdType triangles = cells->GetNumberOfConnectivityIds() - 2 * cells->GetNumberOfCells();
+    indices += 3 * std::max<vtkIdType>(triangles, 0);
+  }
+  return surface->GetNumberOfPoints() * bytesPerPoint + indices * indexBytes;
+}
+
+//----------------------------------------------------------------------------
+// Size in bytes of the images of the textures of an actor, ignoring accounted arrays
+vtkIdType GetTexturesBytes(vtkActor* actor, std::set<vtkAbstractArray*>& accounted)
+{
+  std::vector<vtkTexture*> textures = { actor->GetTexture() };
+  for (const auto& [name, texture] : actor->GetProperty()->GetAllTextures())
+  {
+    textures.emplace_back(texture);
+  }
+
+  vtkIdType bytes = 0;
+  for (vtkTexture* texture : textures)
+  {
+    vtkImageData* image = texture ? vtkImageData::SafeDownCast(texture->GetInput()) : nullptr;
+    if (image)
+    {
+      bytes += ::GetFieldDataBytes(image->GetPointData(), accounted);
+    }
+  }
+  return bytes;
+}
+
+//----------------------------------------------------------------------------
+std::string FormatBytes(vtkIdType bytes)
+{
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.1f MiB", static_cast<double>(bytes) / (1 << 20));
+  return buffer;
+}
+
+//----------------------------------------------------------------------------
+// Remove the structs derived from the removed actors and their prop from the renderer.
+// Structs are moved rather than erased as they are not assignable.
+template<typename T, typename P>
+void RemoveDerivedStructs(std::vector<T>& structs, vtkNew<P> T::*prop,
+  const std::set<vtkActor*>& removedActors, vtkRenderer* renderer)
+{
+  std::vector<T> kept;
+  kept.reserve(structs.size());
+  for (T& derived : structs)
+  {
+    if (removedActors.count(derived.OriginalActor) == 0)
+    {
+      kept.emplace_back(std::move(derived));
+    }
+    else if (renderer)
+    {
+      renderer->RemoveViewProp((derived.*prop).GetPointer());
+    }
+  }
+  structs.swap(kept);
+}
 }
 
 //----------------------------------------------------------------------------
@@ -167,7 +357,35 @@ void vtkF3DMetaImporter::AddImporter(
     importer.first, importer.second, false, vtkSmartPointer<vtkDataAssembly>::New() });
   this->Modified();
 
-  // Add a progress event observer
+  this->ObserveProgress(importer.second);
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DMetaImporter::ReplaceImporter(
+  int index, const std::pair<std::string, vtkSmartPointer<vtkImporter>>& importer)
+{
+  assert(index >= 0 && index < this->GetImporterInfoCount());
+  vtkF3DMetaImporter::ImporterInfo& importerInfo = this->Pimpl->Importers[index];
+
+  if (importerInfo.Updated)
+  {
+    this->RemoveImportedProps(importerInfo.Importer);
+  }
+  importerInfo.Importer->RemoveObservers(vtkCommand::ProgressEvent);
+
+  importerInfo = vtkF3DMetaImporter::ImporterInfo{ importer.first, importer.second, false,
+    vtkSmartPointer<vtkDataAssembly>::New() };
+
+  // Arrays and ranges of the replaced importer must not be kept
+  this->Pimpl->ColoringInfoHandler.ClearColoringInfo();
+  this->Modified();
+
+  this->ObserveProgress(importer.second);
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DMetaImporter::ObserveProgress(vtkImporter* importer)
+{
   vtkNew<vtkCallbackCommand> progressCallback;
   progressCallback->SetClientData(this);
   progressCallback->SetCallback(
@@ -187,7 +405,69 @@ void vtkF3DMetaImporter::AddImporter(
       }
       self->InvokeEvent(vtkCommand::ProgressEvent, &actualProgress);
     });
-  importer.second->AddObserver(vtkCommand::ProgressEvent, progressCallback);
+  importer->AddObserver(vtkCommand::ProgressEvent, progressCallback);
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DMetaImporter::RemoveImportedProps(vtkImporter* importer)
+{
+  vtkRenderer* renderer = this->Renderer;
+
+  std::set<vtkActor*> removedActors;
+  vtkActorCollection* actorCollection = importer->GetImportedActors();
+  vtkCollectionSimpleIterator ait;
+  actorCollection->InitTraversal(ait);
+  while (vtkActor* actor = actorCollection->GetNextActor(ait))
+  {
+    removedActors.insert(actor);
+    this->ActorCollection->RemoveItem(actor);
+    if (renderer)
+    {
+      renderer->RemoveActor(actor);
+    }
+  }
+
+  if (renderer)
+  {
+    vtkLightCollection* lightCollection = importer->GetImportedLights();
+    vtkCollectionSimpleIterator lit;
+    lightCollection->InitTraversal(lit);
+    while (vtkLight* light = lightCollection->GetNextLight(lit))
+    {
+      renderer->RemoveLight(light);
+    }
+  }
+
+  ::RemoveDerivedStructs(this->Pimpl->ColoringActorsAndMappers, &ColoringStruct::Actor,
+    removedActors, renderer);
+  ::RemoveDerivedStructs(this->Pimpl->NormalGlyphsActorsAndMappers, &NormalGlyphsStruct::Actor,
+    removedActors, renderer);
+  ::RemoveDerivedStructs(this->Pimpl->PointSpritesActorsAndMappers, &PointSpritesStruct::Actor,
+    removedActors, renderer);
+  ::RemoveDerivedStructs(
+    this->Pimpl->VolumePropsAndMappers, &VolumeStruct::Prop, removedActors, renderer);
+
+  // The bounding box can only grow, compute it again from the actors of the other importers
+  this->Pimpl->GeometryBoundingBox.Reset();
+  for (const auto& importerInfo : this->Pimpl->Importers)
+  {
+    if (!importerInfo.Updated || importerInfo.Importer == importer)
+    {
+      continue;
+    }
+
+    bool isGeneric = vtkF3DGenericImporter::SafeDownCast(importerInfo.Importer) != nullptr;
+    vtkActorCollection* importedActors = importerInfo.Importer->GetImportedActors();
+    importedActors->InitTraversal(ait);
+    while (vtkActor* actor = importedActors->GetNextActor(ait))
+    {
+      // Actors without poly data mapper are not rendered, see Update
+      if (vtkPolyDataMapper::SafeDownCast(actor->GetMapper()))
+      {
+        ::AddActorBounds(this->Pimpl->GeometryBoundingBox, actor, isGeneric);
+      }
+    }
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -242,6 +522,8 @@ bool vtkF3DMetaImporter::Update()
   this->Renderer = this->RenderWindow->GetRenderers()->GetFirstRenderer();
   assert(this->Renderer);
 
+  F3DTrace::Scope trace("update importers", "load");
+
   vtkIdType localCameraIndex = -1;
 
   this->Pimpl->UpdateTime.Modified();
@@ -268,6 +550,8 @@ bool vtkF3DMetaImporter::Update()
       continue;
     }
 
+    F3DTrace::Scope importerTrace("import", importerInfo.Name, "load");
+
     importer->SetRenderWindow(this->RenderWindow);
 
     // This is required to avoid updating two times
@@ -277,7 +561,12 @@ bool vtkF3DMetaImporter::Update()
       importer->SetCamera(localCameraIndex);
     }
 
-    if (!importer->Update())
+    bool updated;
+    {
+      F3DTrace::Scope updateTrace("update", importer->GetClassName(), "load");
+      updated = importer->Update();
+    }
+    if (!updated)
     {
       return false;
     }
@@ -333,6 +622,8 @@ bool vtkF3DMetaImporter::Update()
         continue;
       }
 
+      F3DTrace::Scope actorTrace("setup actor", actorIndex, "load");
+
       // Add to the actor collection
       this->ActorCollection->AddItem(actor);
 
@@ -379,14 +670,24 @@ bool vtkF3DMetaImporter::Update()
       }
 
       // Increase bounding box size if needed
-      double bounds[6];
-      surface->GetBounds(bounds);
-      this->Pimpl->GeometryBoundingBox.AddBounds(bounds);
+      {
+        F3DTrace::Scope boundsTrace("bounds", "load");
+        // Generic importers position shared blocks with the actor user matrix
+        ::AddActorBounds(this->Pimpl->GeometryBoundingBox, actor, genericImporter != nullptr);
+      }
+
+      // Instanced mappers are only supported by the surface actors, normal glyphs and point
+      // sprites would only display the prototype and are disabled by the renderer
+      bool isInstanced =
+        pdMapper->GetInformation()->Has(vtkF3DImporter::MAPPER_INSTANCE_MATRICES());
 
       // Create and configure coloring actors
       this->Pimpl->ColoringActorsAndMappers.emplace_back(vtkF3DMetaImporter::ColoringStruct(actor));
       vtkF3DMetaImporter::ColoringStruct& cs = this->Pimpl->ColoringActorsAndMappers.back();
       cs.Mapper->SetInputData(surface);
+      cs.Mapper->GetInformation()->CopyEntry(
+        pdMapper->GetInformation(), vtkF3DImporter::MAPPER_INSTANCE_MATRICES());
+      cs.IsInstanced = isInstanced;
       this->Renderer->AddActor(cs.Actor);
       cs.Actor->VisibilityOff();
 
@@ -404,6 +705,7 @@ bool vtkF3DMetaImporter::Update()
         this->Pimpl->NormalGlyphsActorsAndMappers.back();
 
       ngs.InputDataHasNormals = points->GetPointData()->GetNormals() != nullptr;
+      ngs.IsInstanced = isInstanced;
 
       if (ngs.InputDataHasNormals)
       {
@@ -425,6 +727,7 @@ bool vtkF3DMetaImporter::Update()
         this->Pimpl->PointSpritesActorsAndMappers.back();
 
       pss.Mapper->SetInputData(points);
+      pss.IsInstanced = isInstanced;
       this->Renderer->AddActor(pss.Actor);
       pss.Actor->VisibilityOff();
 
@@ -434,6 +737,8 @@ bool vtkF3DMetaImporter::Update()
         vtkImageData* image = genericImporter->GetImportedImage(actorIndex);
         if (image)
         {
+          F3DTrace::Scope volumeTrace("volume setup", "load");
+
           // XXX: Note that creating this struct takes some time
           this->Pimpl->VolumePropsAndMappers.emplace_back(vtkF3DMetaImporter::VolumeStruct(actor));
           vtkF3DMetaImporter::VolumeStruct& vs = this->Pimpl->VolumePropsAndMappers.back();
@@ -726,11 +1031,44 @@ bool vtkF3DMetaImporter::UpdateAtTimeValue(double timeValue)
     ret = ret && importerInfo.Importer->UpdateAtTimeValue(timeValue);
   }
 
+  this->UpdateDerivedActors();
+  this->Pimpl->UpdateTime.Modified();
+  return ret;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DMetaImporter::UpdateModifiedImporters()
+{
+  bool updated = false;
+  for (const auto& importerInfo : this->Pimpl->Importers)
+  {
+    vtkF3DGenericImporter* genericImporter =
+      vtkF3DGenericImporter::SafeDownCast(importerInfo.Importer);
+    if (genericImporter && importerInfo.Updated)
+    {
+      updated = genericImporter->UpdateIfModified() || updated;
+    }
+  }
+
+  if (updated)
+  {
+    this->UpdateDerivedActors();
+    this->Pimpl->UpdateTime.Modified();
+  }
+  return updated;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DMetaImporter::UpdateDerivedActors()
+{
   // Update coloring and point sprites
   for (auto& cs : this->Pimpl->ColoringActorsAndMappers)
   {
-    cs.Mapper->SetInputData(
-      vtkPolyDataMapper::SafeDownCast(cs.OriginalActor->GetMapper())->GetInput());
+    vtkPolyDataMapper* originalMapper =
+      vtkPolyDataMapper::SafeDownCast(cs.OriginalActor->GetMapper());
+    cs.Mapper->SetInputData(originalMapper->GetInput());
+    cs.Mapper->GetInformation()->CopyEntry(
+      originalMapper->GetInformation(), vtkF3DImporter::MAPPER_INSTANCE_MATRICES());
 
     bool visi = cs.Actor->GetVisibility();
     cs.Actor->vtkProp3D::ShallowCopy(cs.OriginalActor);
@@ -747,9 +1085,6 @@ bool vtkF3DMetaImporter::UpdateAtTimeValue(double timeValue)
       pss.Actor->SetVisibility(visi);
     }
   }
-
-  this->Pimpl->UpdateTime.Modified();
-  return ret;
 }
 
 //----------------------------------------------------------------------------
@@ -757,6 +1092,7 @@ void vtkF3DMetaImporter::UpdateInfoForColoring()
 {
   if (this->Pimpl->UpdateTime.GetMTime() > this->Pimpl->ColoringInfoTime.GetMTime())
   {
+    F3DTrace::Scope trace("coloring range scan", "load");
     for (const auto& importerInfo : this->Pimpl->Importers)
     {
       vtkActorCollection* actorCollection = importerInfo.Importer->GetImportedActors();
@@ -804,7 +1140,7 @@ void vtkF3DMetaImporter::UpdateInfoForColoring()
 }
 
 //----------------------------------------------------------------------------
-std::string vtkF3DMetaImporter::GetMetaDataDescription() const
+std::string vtkF3DMetaImporter::GetMetaDataDescription(bool includeMemory) const
 {
   std::string description;
   if (this->Pimpl->Importers.size() > 1)
@@ -834,9 +1170,159 @@ std::string vtkF3DMetaImporter::GetMetaDataDescription() const
   description += "\n";
   description += "Number of cells: ";
   description += std::to_string(nCells);
+  if (!includeMemory)
+  {
+    return description;
+  }
+
+  // Host memory includes the textures, which are also uploaded to the GPU
+  std::vector<vtkF3DMetaImporter::ImporterMemoryUsage> usages = this->GetMemoryUsage();
+  vtkF3DMetaImporter::MemoryUsage total;
+  for (const auto& importerUsage : usages)
+  {
+    total += importerUsage.Total;
+  }
+  description += "\nHost memory: ";
+  description += ::FormatBytes(total.HostBytes + total.TextureBytes);
+  description += "\nGPU memory (estimated): ";
+  description += ::FormatBytes(total.GeometryBytes + total.TextureBytes + total.AuxiliaryBytes);
+  if (usages.size() > 1)
+  {
+    for (const auto& importerUsage : usages)
+    {
+      description += "\n  ";
+      description += vtksys::SystemTools::GetFilenameName(importerUsage.Name);
+      description += ": ";
+      description += ::FormatBytes(importerUsage.Total.GetTotalBytes());
+    }
+  }
   return description;
 }
 
+//----------------------------------------------------------------------------
+vtkF3DMetaImporter::MemoryUsage& vtkF3DMetaImporter::MemoryUsage::operator+=(
+  const MemoryUsage& other)
+{
+  this->HostBytes += other.HostBytes;
+  this->GeometryBytes += other.GeometryBytes;
+  this->TextureBytes += other.TextureBytes;
+  this->AuxiliaryBytes += other.AuxiliaryBytes;
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkF3DMetaImporter::MemoryUsage::GetTotalBytes() const
+{
+  return this->HostBytes + this->GeometryBytes + this->TextureBytes + this->AuxiliaryBytes;
+}
+
+//----------------------------------------------------------------------------
+std::vector<vtkF3DMetaImporter::ImporterMemoryUsage> vtkF3DMetaImporter::GetMemoryUsage() const
+{
+  // Structs derived from each original actor, the first one is used like in the renderer
+  struct DerivedStructs
+  {
+    const NormalGlyphsStruct* Glyphs = nullptr;
+    const PointSpritesStruct* Sprites = nullptr;
+    const VolumeStruct* Volume = nullptr;
+  };
+  std::unordered_map<vtkActor*, DerivedStructs> derivedStructs;
+  for (const NormalGlyphsStruct& ngs : this->Pimpl->NormalGlyphsActorsAndMappers)
+  {
+    DerivedStructs& derived = derivedStructs[ngs.OriginalActor];
+    derived.Glyphs = derived.Glyphs ? derived.Glyphs : &ngs;
+  }
+  for (const PointSpritesStruct& pss : this->Pimpl->PointSpritesActorsAndMappers)
+  {
+    DerivedStructs& derived = derivedStructs[pss.OriginalActor];
+    derived.Sprites = derived.Sprites ? derived.Sprites : &pss;
+  }
+  for (const VolumeStruct& vs : this->Pimpl->VolumePropsAndMappers)
+  {
+    DerivedStructs& derived = derivedStructs[vs.OriginalActor];
+    derived.Volume = derived.Volume ? derived.Volume : &vs;
+  }
+
+  std::vector<vtkF3DMetaImporter::ImporterMemoryUsage> usages;
+  for (const auto& importerInfo : this->Pimpl->Importers)
+  {
+    if (!importerInfo.Updated)
+    {
+      continue;
+    }
+
+    vtkF3DMetaImporter::ImporterMemoryUsage importerUsage;
+    importerUsage.Name = importerInfo.Name;
+
+    // Arrays are shared between the imported actors and their derived structs,
+    // and sometimes between actors, eg: with instancing
+    std::set<vtkAbstractArray*> accounted;
+
+    vtkActorCollection* actorCollection = importerInfo.Importer->GetImportedActors();
+    vtkCollectionSimpleIterator ait;
+    actorCollection->InitTraversal(ait);
+    while (vtkActor* actor = actorCollection->GetNextActor(ait))
+    {
+      // Actors without poly data mapper are not rendered, see Update
+      vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
+      if (pdMapper == nullptr)
+      {
+        continue;
+      }
+
+      vtkF3DMetaImporter::MemoryUsage usage;
+      vtkPolyData* surface = pdMapper->GetInput();
+      usage.HostBytes = ::GetDataSetBytes(surface, accounted);
+      usage.GeometryBytes = surface ? ::EstimateGeometryBytes(surface) : 0;
+      usage.TextureBytes = ::GetTexturesBytes(actor, accounted);
+
+      auto derivedIt = derivedStructs.find(actor);
+      const DerivedStructs derived =
+        derivedIt != derivedStructs.end() ? derivedIt->second : DerivedStructs();
+
+      const NormalGlyphsStruct* ngs = derived.Glyphs;
+      vtkDataSet* glyphsInput = ngs ? ngs->GlyphMapper->GetInput() : nullptr;
+      if (glyphsInput && ngs->InputDataHasNormals && ngs->Actor->GetVisibility())
+      {
+        usage.AuxiliaryBytes += glyphsInput->GetNumberOfPoints() * ::NORMAL_GLYPH_BYTES;
+      }
+
+      // Generic importers provide dedicated points for the point sprites
+      const PointSpritesStruct* pss = derived.Sprites;
+      if (pss)
+      {
+        vtkPolyData* points = pss->Mapper->GetInput();
+        usage.HostBytes += ::GetDataSetBytes(points, accounted);
+        if (points && pss->Actor->GetVisibility())
+        {
+          usage.AuxiliaryBytes += points->GetNumberOfPoints() * ::POINT_SPRITE_BYTES;
+        }
+      }
+
+      // The rendered array of a volume is uploaded as a 3D texture
+      const VolumeStruct* vs = derived.Volume;
+      if (vs)
+      {
+        vtkDataSet* image = vs->Mapper->GetInput();
+        usage.HostBytes += ::GetDataSetBytes(image, accounted);
+        int cellFlag = 0;
+        vtkDataArray* scalars = vtkAbstractMapper::GetScalars(image, vs->Mapper->GetScalarMode(),
+          vs->Mapper->GetArrayAccessMode(), vs->Mapper->GetArrayId(), vs->Mapper->GetArrayName(),
+          cellFlag);
+        if (scalars && vs->Prop->GetVisibility())
+        {
+          usage.AuxiliaryBytes += scalars->GetDataSize() * scalars->GetDataTypeSize();
+        }
+      }
+
+      importerUsage.Total += usage;
+      importerUsage.Actors.emplace_back(usage);
+    }
+    usages.emplace_back(std::move(importerUsage));
+  }
+  return usages;
+}
+
 //----------------------------------------------------------------------------
 F3DColoringInfoHandler& vtkF3DMetaImporter::GetColoringInfoHandler()
 {
@@ -844,6 +1330,45 @@ F3DColoringInfoHandler& vtkF3DMetaImporter::GetColoringInfoHandler()
   return this->Pimpl->ColoringInfoHandler;
 }
 
+//----------------------------------------------------------------------------
+bool vtkF3DMetaImporter::LoadDeferredArrays(const std::optional<std::string>& arrayName)
+{
+  bool loaded = false;
+  for (const auto& importerInfo : this->Pimpl->Importers)
+  {
+    vtkF3DGenericImporter* genericImporter =
+      vtkF3DGenericImporter::SafeDownCast(importerInfo.Importer);
+    if (genericImporter && importerInfo.Updated)
+    {
+      loaded = genericImporter->LoadDeferredArrays(arrayName) || loaded;
+    }
+  }
+
+  if (loaded)
+  {
+    // Blocks outputs are updated in place, only the coloring information needs to be refreshed
+    this->Pimpl->UpdateTime.Modified();
+  }
+  return loaded;
+}
+
+//----------------------------------------------------------------------------
+std::set<std::string> vtkF3DMetaImporter::GetDeferredArrayNames()
+{
+  std::set<std::string> names;
+  for (const auto& importerInfo : this->Pimpl->Importers)
+  {
+    vtkF3DGenericImporter* genericImporter =
+      vtkF3DGenericImporter::SafeDownCast(importerInfo.Importer);
+    if (genericImporter && importerInfo.Updated)
+    {
+      std::vector<std::string> importerNames = genericImporter->GetDeferredArrayNames();
+      names.insert(importerNames.begin(), importerNames.end());
+    }
+  }
+  return names;
+}
+
 //----------------------------------------------------------------------------
 vtkMTimeType vtkF3DMetaImporter::GetUpdateMTime()
 {
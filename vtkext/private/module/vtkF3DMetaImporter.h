@@ -18,6 +18,8 @@
 #include <vtkVolume.h>
 
 #include <memory>
+#include <optional>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -58,6 +60,7 @@ public:
     vtkNew<vtkPointGaussianMapper> Mapper;
     vtkActor* OriginalActor;
     vtkImporter* Importer;
+    bool IsInstanced = false;
   };
 
   struct NormalGlyphsStruct
@@ -75,6 +78,7 @@ public:
     vtkImporter* Importer;
     vtkNew<vtkGlyph3DMapper> GlyphMapper;
     bool InputDataHasNormals = false;
+    bool IsInstanced = false;
   };
 
   struct ColoringStruct
@@ -94,6 +98,7 @@ public:
     vtkNew<vtkActor> Actor;
     vtkNew<vtkPolyDataMapper> Mapper;
     vtkActor* OriginalActor;
+    bool IsInstanced = false;
   };
 
   struct ImporterInfo
@@ -105,6 +110,30 @@ public:
   };
   ///@}
 
+  ///@{
+  /**
+   * Structs describing the memory used by an imported actor or by all actors of an importer,
+   * in bytes. GPU sizes are estimated from the data to upload, see GetMemoryUsage.
+   */
+  struct MemoryUsage
+  {
+    vtkIdType HostBytes = 0;
+    vtkIdType GeometryBytes = 0;
+    vtkIdType TextureBytes = 0;
+    vtkIdType AuxiliaryBytes = 0;
+
+    MemoryUsage& operator+=(const MemoryUsage& other);
+    vtkIdType GetTotalBytes() const;
+  };
+
+  struct ImporterMemoryUsage
+  {
+    std::string Name;
+    MemoryUsage Total;
+    std::vector<MemoryUsage> Actors;
+  };
+  ///@}
+
   /**
    * Clear all importers and internal structures
    */
@@ -116,6 +145,15 @@ public:
    */
   void AddImporter(const std::pair<std::string, vtkSmartPointer<vtkImporter>>& importer);
 
+  /**
+   * Replace the importer at the provided index with another one, eg: to reload a modified file.
+   * The actors, lights and derived actors of the replaced importer are removed from the renderer
+   * and the new importer will be imported on the next Update, while other importers are kept as is.
+   * The coloring information is cleared and will be recovered from all importers after the update.
+   */
+  void ReplaceImporter(
+    int index, const std::pair<std::string, vtkSmartPointer<vtkImporter>>& importer);
+
   /**
    * Get the bounding box of all geometry actors
    * Should be called after actors have been imported
@@ -123,9 +161,22 @@ public:
   const vtkBoundingBox& GetGeometryBoundingBox();
 
   /**
-   * Get a meta data description of all imported data
+   * Get a meta data description of all imported data,
+   * including the memory usage if requested, see GetMemoryUsage
+   */
+  std::string GetMetaDataDescription(bool includeMemory = false) const;
+
+  /**
+   * Get the memory used by each updated importer and each of its actors:
+   *  - host: points, cells and attribute arrays of the imported data in CPU memory
+   *  - geometry: vertex and index buffers of the surfaces in GPU memory
+   *  - textures: images of the textures, in CPU memory and uploaded to the GPU
+   *  - auxiliary: GPU memory of the visible normal glyphs, point sprites and volume
+   * Arrays shared by multiple actors of an importer are only accounted for the first one.
+   * GPU sizes are estimated from the number of points, cells and arrays to upload,
+   * as the actual buffers depend on the rendering options and the graphics driver.
    */
-  std::string GetMetaDataDescription() const;
+  std::vector<ImporterMemoryUsage> GetMemoryUsage() const;
 
   F3DColoringInfoHandler& GetColoringInfoHandler();
 
@@ -200,6 +251,25 @@ public:
    */
   bool UpdateAtTimeValue(double timeValue) override;
 
+  /**
+   * Load arrays that readers do not read by default, see vtkF3DGenericImporter::LoadDeferredArrays.
+   * If arrayName is provided, only this array is loaded, otherwise all deferred arrays are.
+   * Return true if an array was loaded, in which case the update mTime is modified.
+   */
+  bool LoadDeferredArrays(const std::optional<std::string>& arrayName);
+
+  /**
+   * Get the names of the deferred arrays that are not loaded yet, sorted by name.
+   */
+  std::set<std::string> GetDeferredArrayNames();
+
+  /**
+   * Update the generic importers whose reader has been modified since their last update,
+   * see vtkF3DGenericImporter::UpdateIfModified.
+   * Return true if any importer was updated, in which case the update mTime is modified.
+   */
+  bool UpdateModifiedImporters();
+
   /**
    * Get the update mTime
    */
@@ -224,6 +294,23 @@ private:
    */
   void UpdateInfoForColoring();
 
+  /**
+   * Refresh the coloring and point sprites actors from the actors of each importer,
+   * after they have been updated
+   */
+  void UpdateDerivedActors();
+
+  /**
+   * Forward the progress of an individual importer as the progress of all importers
+   */
+  void ObserveProgress(vtkImporter* importer);
+
+  /**
+   * Remove the actors, lights and derived actors of an updated importer from the renderer
+   * and the internal structures
+   */
+  void RemoveImportedProps(vtkImporter* importer);
+
   struct Internals;
   std::unique_ptr<Internals> Pimpl;
 };
@@ -87,6 +87,7 @@ void vtkF3DOpenGLGridMapper::ReplaceShaderValues(
       "uniform sampler2D reflectionDepthTexture;\n"
       "uniform sampler2D reflectionColorTexture;\n"
       "uniform float reflectionStrength;\n"
+      "uniform vec2 reflectionBlurOffset;\n"
     );
   }
 
@@ -125,7 +126,11 @@ void vtkF3DOpenGLGridMapper::ReplaceShaderValues(
       "    vec2 screenUV = gl_FragCoord.xy * pixelSize;\n"
       "    screenUV.x = 1.0 - screenUV.x;\n"
       "    float reflectionDepth = texture(reflectionDepthTexture, screenUV).r;\n"
-      "    vec4 reflectionColor = reflectionStrength * texture(reflectionColorTexture, screenUV);\n"
+      "    vec4 reflectionColor = 0.25 * reflectionStrength * (\n"
+      "      texture(reflectionColorTexture, screenUV - reflectionBlurOffset) +\n"
+      "      texture(reflectionColorTexture, screenUV + reflectionBlurOffset) +\n"
+      "      texture(reflectionColorTexture, screenUV + vec2(-1.0, 1.0) * reflectionBlurOffset) +\n"
+      "      texture(reflectionColorTexture, screenUV + vec2(1.0, -1.0) * reflectionBlurOffset));\n"
       "    if (reflectionDepth < gl_FragCoord.z) reflectionColor = vec4(0.0);\n"
       "    color.rgb = color.a * color.rgb;"
       "    color = color + reflectionColor * (1.0 - color.a);\n"
@@ -217,6 +222,19 @@ void vtkF3DOpenGLGridMapper::SetMapperShaderParameters(
     const float pixelSize[2] = { 1.f / (viewportSize[0] * scaling),
       1.f / (viewportSize[1] * scaling) };
     cellBO.Program->SetUniform2f("pixelSize", pixelSize);
+
+    // A reflection rendered at a lower resolution is upsampled with a blur of one of its texels
+    // to hide the blocky look of the bilinear filtering, nothing is blurred at full resolution
+    float blurOffset[2] = { 0.f, 0.f };
+    const unsigned int reflectionWidth = this->ReflectionColorTexture->GetWidth();
+    const unsigned int reflectionHeight = this->ReflectionColorTexture->GetHeight();
+    if (reflectionWidth > 0 && reflectionHeight > 0 &&
+      reflectionWidth < static_cast<unsigned int>(viewportSize[0] * scaling))
+    {
+      blurOffset[0] = 1.f / reflectionWidth;
+      blurOffset[1] = 1.f / reflectionHeight;
+    }
+    cellBO.Program->SetUniform2f("reflectionBlurOffset", blurOffset);
   }
 }
 
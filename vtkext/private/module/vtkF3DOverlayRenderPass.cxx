@@ -2,6 +2,8 @@
 
 #include <vtkCameraPass.h>
 #include <vtkDefaultPass.h>
+#include <vtkInformation.h>
+#include <vtkInformationIntegerKey.h>
 #include <vtkObjectFactory.h>
 #include <vtkOpenGLError.h>
 #include <vtkOpenGLFramebufferObject.h>
@@ -19,6 +21,8 @@
 
 vtkStandardNewMacro(vtkF3DOverlayRenderPass);
 
+vtkInformationKeyMacro(vtkF3DOverlayRenderPass, HIDE_OVERLAY, Integer);
+
 // ----------------------------------------------------------------------------
 void vtkF3DOverlayRenderPass::Render(const vtkRenderState* s)
 {
@@ -73,11 +77,13 @@ void vtkF3DOverlayRenderPass::Initialize(const vtkRenderState* s)
   this->OverlayProps.clear();
 
   // assign props to the overlay pass
+  bool hideOverlay =
+    s->GetRenderer()->GetInformation()->Has(vtkF3DOverlayRenderPass::HIDE_OVERLAY());
   vtkProp** props = s->GetPropArray();
   for (int i = 0; i < s->GetPropArrayCount(); i++)
   {
     vtkProp* prop = props[i];
-    if (!vtkProp3D::SafeDownCast(prop))
+    if (!hideOverlay && !vtkProp3D::SafeDownCast(prop))
     {
       this->OverlayProps.push_back(prop);
     }
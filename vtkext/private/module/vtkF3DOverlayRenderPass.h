@@ -16,6 +16,7 @@
 #include <vtkOpenGLQuadHelper.h>
 #include <vtkSmartPointer.h>
 
+class vtkInformationIntegerKey;
 class vtkProp;
 
 class vtkF3DOverlayRenderPass : public vtkImageProcessingPass
@@ -40,6 +41,11 @@ public:
   vtkF3DOverlayRenderPass(const vtkF3DOverlayRenderPass&) = delete;
   void operator=(const vtkF3DOverlayRenderPass&) = delete;
 
+  /**
+   * Key set on the renderer information to skip the overlay props, eg. the UI
+   */
+  static vtkInformationIntegerKey* HIDE_OVERLAY();
+
 protected:
   void Initialize(const vtkRenderState* s);
 
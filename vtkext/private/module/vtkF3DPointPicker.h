@@ -0,0 +1,35 @@
+/**
+ * @class   vtkF3DPointPicker
+ * @brief   Point picker supporting instanced mappers
+ *
+ * Look for the closest point of each instance of mappers with
+ * vtkF3DImporter::MAPPER_INSTANCE_MATRICES set instead of only the instanced geometry.
+ */
+
+#ifndef vtkF3DPointPicker_h
+#define vtkF3DPointPicker_h
+
+#include <vtkPointPicker.h>
+
+class vtkF3DPointPicker : public vtkPointPicker
+{
+public:
+  static vtkF3DPointPicker* New();
+  vtkTypeMacro(vtkF3DPointPicker, vtkPointPicker);
+
+protected:
+  vtkF3DPointPicker() = default;
+  ~vtkF3DPointPicker() override = default;
+
+  /**
+   * Intersect the line with all instances of the mapper, in the mapper coordinates
+   */
+  double IntersectWithLine(const double p1[3], const double p2[3], double tol,
+    vtkAssemblyPath* path, vtkProp3D* prop, vtkAbstractMapper3D* mapper) override;
+
+private:
+  vtkF3DPointPicker(const vtkF3DPointPicker&) = delete;
+  void operator=(const vtkF3DPointPicker&) = delete;
+};
+
+#endif
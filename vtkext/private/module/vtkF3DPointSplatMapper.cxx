@@ -3,6 +3,7 @@
 #if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
 #include "vtkF3DBitonicSort.h"
 #include "vtkF3DComputeDepthCS.h"
+#include "vtkF3DFrameProfiler.h"
 #endif
 #include "vtkF3DPointSplatVS.h"
 #include "vtkF3DRenderer.h"
@@ -350,6 +351,8 @@ void vtkF3DSplatMapperHelper::SortSplats(vtkRenderer* ren)
     return;
   }
 
+  vtkF3DFrameProfiler::Scope scope(ren, "splat sort");
+
   int numVerts = this->VBOs->GetNumberOfTuples("vertexMC");
 
   vtkOpenGLShaderCache* shaderCache =
@@ -384,6 +387,8 @@ void vtkF3DSplatMapperHelper::SortSplatsCPU(vtkRenderer* ren)
     return;
   }
 
+  vtkF3DFrameProfiler::Scope scope(ren, "splat sort");
+
   int numVerts = this->VBOs->GetNumberOfTuples("vertexMC");
 
   this->CPUSortedIndices.resize(static_cast<size_t>(numVerts));
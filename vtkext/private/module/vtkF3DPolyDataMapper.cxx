@@ -1,13 +1,22 @@
 #include "vtkF3DPolyDataMapper.h"
 
 #include "F3DLog.h"
+#include "vtkF3DImporter.h"
 
 #include <vtkActor.h>
+#include <vtkBoundingBox.h>
+#include <vtkDataArray.h>
 #include <vtkDoubleArray.h>
+#include <vtkHardwareSelector.h>
+#include <vtkInformation.h>
+#include <vtkInformationDoubleVectorKey.h>
+#include <vtkMath.h>
 #include <vtkMatrix4x4.h>
 #include <vtkObjectFactory.h>
+#include <vtkOpenGLIndexBufferObject.h>
 #include <vtkOpenGLRenderWindow.h>
 #include <vtkOpenGLRenderer.h>
+#include <vtkOpenGLVertexArrayObject.h>
 #include <vtkOpenGLVertexBufferObject.h>
 #include <vtkOpenGLVertexBufferObjectGroup.h>
 #include <vtkPointData.h>
@@ -18,6 +27,10 @@
 #include <vtkTexture.h>
 #include <vtkUniforms.h>
 #include <vtkVersion.h>
+#include <vtk_glad.h>
+
+#include <algorithm>
+#include <string>
 
 vtkStandardNewMacro(vtkF3DPolyDataMapper);
 
@@ -203,6 +216,27 @@ void vtkF3DPolyDataMapper::ReplaceShaderValues(
     }
   }
 
+  // instancing, applied after skinning and morphing which are defined in the mesh space
+  if (this->UseInstancing)
+  {
+    customDecl += "in mat4 instanceMatrix;\n";
+
+    posImpl += "  posMC = instanceMatrix * posMC;\n";
+
+    if (hasNormals || hasTangents)
+    {
+      beginImpl += "  mat3 instanceNormalMatrix = transpose(inverse(mat3(instanceMatrix)));\n";
+    }
+    if (hasNormals)
+    {
+      normalImpl += "  normalVCVSOutput = instanceNormalMatrix * normalVCVSOutput;\n";
+    }
+    if (hasTangents)
+    {
+      normalImpl += "  tangentVCVSOutput = instanceNormalMatrix * tangentVCVSOutput;\n";
+    }
+  }
+
   posImpl += "  gl_Position = MCDCMatrix * posMC;\n";
 
   if (this->PrimitiveInfo[this->LastBoundBO].LastLightComplexity > 0)
@@ -229,6 +263,183 @@ void vtkF3DPolyDataMapper::ReplaceShaderValues(
   this->Superclass::ReplaceShaderValues(shaders, ren, actor);
 }
 
+//-----------------------------------------------------------------------------
+int vtkF3DPolyDataMapper::GetNumberOfInstances()
+{
+  return this->GetInformation()->Length(vtkF3DImporter::MAPPER_INSTANCE_MATRICES()) / 16;
+}
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::ComputeBounds()
+{
+  this->Superclass::ComputeBounds();
+
+  // Morph targets displace the points in the vertex shader, the weights are not known here
+  // so the bounds include any combination of targets with weights between 0 and 1
+  vtkPolyData* input = this->GetInput();
+  if (input && vtkMath::AreBoundsInitialized(this->Bounds))
+  {
+    for (int i = 0; i < 4; i++)
+    {
+      std::string name = "target" + std::to_string(i) + "_position";
+      vtkDataArray* target = input->GetPointData()->GetArray(name.c_str());
+      if (!target || target->GetNumberOfComponents() != 3 || target->GetNumberOfTuples() == 0)
+      {
+        continue;
+      }
+      for (int c = 0; c < 3; c++)
+      {
+        double range[2];
+        target->GetRange(range, c);
+        this->Bounds[2 * c] += std::min(range[0], 0.0);
+        this->Bounds[2 * c + 1] += std::max(range[1], 0.0);
+      }
+    }
+  }
+
+  int nbInstances = this->GetNumberOfInstances();
+  if (nbInstances == 0 || !vtkMath::AreBoundsInitialized(this->Bounds))
+  {
+    return;
+  }
+
+  // transform the corners of the input bounds with each instance matrix
+  const double* matrices = this->GetInformation()->Get(vtkF3DImporter::MAPPER_INSTANCE_MATRICES());
+  vtkBoundingBox bbox;
+  for (int i = 0; i < nbInstances; i++)
+  {
+    for (int c = 0; c < 8; c++)
+    {
+      double corner[4] = { this->Bounds[c & 1], this->Bounds[2 + ((c >> 1) & 1)],
+        this->Bounds[4 + ((c >> 2) & 1)], 1.0 };
+      double transformed[4];
+      vtkMatrix4x4::MultiplyPoint(matrices + 16 * i, corner, transformed);
+      bbox.AddPoint(transformed);
+    }
+  }
+  bbox.GetBounds(this->Bounds);
+}
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::UpdateInstanceMatrices()
+{
+  int nbInstances = this->GetNumberOfInstances();
+  bool useInstancing = nbInstances > 0;
+  if (useInstancing != this->UseInstancing)
+  {
+    this->UseInstancing = useInstancing;
+    this->InstancingToggleTime.Modified();
+  }
+
+  vtkInformation* info = this->GetInformation();
+  if (useInstancing && info->GetMTime() > this->InstanceMatricesTime)
+  {
+    // OpenGL matrices are column-major
+    const double* matrices = info->Get(vtkF3DImporter::MAPPER_INSTANCE_MATRICES());
+    std::vector<float> buffer(16 * static_cast<size_t>(nbInstances));
+    for (size_t i = 0; i < buffer.size(); i += 16)
+    {
+      for (size_t r = 0; r < 4; r++)
+      {
+        for (size_t c = 0; c < 4; c++)
+        {
+          buffer[i + 4 * c + r] = static_cast<float>(matrices[i + 4 * r + c]);
+        }
+      }
+    }
+
+    this->InstanceMatrices->Upload(buffer, vtkOpenGLBufferObject::ArrayBuffer);
+    this->InstanceMatricesTime.Modified();
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool vtkF3DPolyDataMapper::GetNeedToRebuildShaders(
+  vtkOpenGLHelper& cellBO, vtkRenderer* ren, vtkActor* act)
+{
+  return cellBO.ShaderSourceTime < this->InstancingToggleTime ||
+    this->Superclass::GetNeedToRebuildShaders(cellBO, ren, act);
+}
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::SetMapperShaderParameters(
+  vtkOpenGLHelper& cellBO, vtkRenderer* ren, vtkActor* actor)
+{
+  this->Superclass::SetMapperShaderParameters(cellBO, ren, actor);
+
+  if (this->UseInstancing && cellBO.Program->IsAttributeUsed("instanceMatrix"))
+  {
+    cellBO.VAO->Bind();
+    if (!cellBO.VAO->AddAttributeMatrixWithDivisor(cellBO.Program, this->InstanceMatrices,
+          "instanceMatrix", 0, 16 * sizeof(float), VTK_FLOAT, 4, false, 1, 4 * sizeof(float)))
+    {
+      vtkErrorMacro("Error setting instanceMatrix in shader VAO.");
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::RenderPieceDraw(vtkRenderer* ren, vtkActor* actor)
+{
+  this->UpdateInstanceMatrices();
+
+  if (!this->UseInstancing)
+  {
+    this->Superclass::RenderPieceDraw(ren, actor);
+    return;
+  }
+
+  // Same as vtkOpenGLPolyDataMapper but with a single instanced draw call per primitive type
+  int representation = actor->GetProperty()->GetRepresentation();
+
+  // render all cell types as points for point picking, all instances share the same primitive
+  // ids so a selection always refers to the cells of the instanced geometry
+  vtkHardwareSelector* selector = ren->GetSelector();
+  bool pointPicking = false;
+  if (selector && this->PopulateSelectionSettings &&
+    selector->GetFieldAssociation() == vtkDataObject::FIELD_ASSOCIATION_POINTS)
+  {
+    representation = VTK_POINTS;
+    pointPicking = true;
+  }
+
+  bool drawSurfaceWithEdges =
+    actor->GetProperty()->GetEdgeVisibility() && representation == VTK_SURFACE;
+  int nbInstances = this->GetNumberOfInstances();
+
+  for (int i = PrimitiveStart; i < (drawSurfaceWithEdges ? PrimitiveEnd : PrimitiveTriStrips + 1);
+       i++)
+  {
+    this->DrawingVertices = i > PrimitiveTriStrips;
+    if (this->Primitives[i].IBO->IndexCount)
+    {
+      GLenum mode = static_cast<GLenum>(this->GetOpenGLMode(representation, i));
+      if (pointPicking)
+      {
+        glPointSize(this->GetPointPickingPrimitiveSize(i));
+        mode = GL_POINTS;
+      }
+
+      this->UpdateShaders(this->Primitives[i], ren, actor);
+
+      if (mode == GL_LINES && !this->HaveWideLines(ren, actor))
+      {
+        glLineWidth(actor->GetProperty()->GetLineWidth());
+      }
+
+      this->Primitives[i].VAO->Bind();
+      this->Primitives[i].IBO->Bind();
+      glDrawElementsInstanced(mode, static_cast<GLsizei>(this->Primitives[i].IBO->IndexCount),
+        GL_UNSIGNED_INT, nullptr, nbInstances);
+      this->Primitives[i].IBO->Release();
+      this->Primitives[i].VAO->Release();
+
+      int stride = (mode == GL_POINTS ? 1 : (mode == GL_LINES ? 2 : 3));
+      this->PrimitiveIDOffset += static_cast<int>(this->Primitives[i].IBO->IndexCount) / stride;
+    }
+  }
+}
+
 //-----------------------------------------------------------------------------
 bool vtkF3DPolyDataMapper::RenderWithMatCap(vtkActor* actor)
 {
@@ -6,6 +6,7 @@
  * - skinning and morphing capabilities
  * - support for MatCap rendering
  * - support for TAA jittering
+ * - instanced rendering when vtkF3DImporter::MAPPER_INSTANCE_MATRICES is set
  */
 
 #ifndef vtkF3DPolyDataMapper_h
@@ -42,13 +43,49 @@ protected:
   vtkF3DPolyDataMapper();
   ~vtkF3DPolyDataMapper() override = default;
 
+  /**
+   * Expand the bounds to include morph targets displacements and all instances
+   */
+  void ComputeBounds() override;
+
+  /**
+   * Draw all instances with a single call per primitive type when instancing
+   */
+  void RenderPieceDraw(vtkRenderer* ren, vtkActor* actor) override;
+
+  /**
+   * Rebuild the shaders when instancing is toggled
+   */
+  bool GetNeedToRebuildShaders(vtkOpenGLHelper& cellBO, vtkRenderer* ren, vtkActor* act) override;
+
+  /**
+   * Bind the per-instance matrices attribute
+   */
+  void SetMapperShaderParameters(
+    vtkOpenGLHelper& cellBO, vtkRenderer* ren, vtkActor* actor) override;
+
 private:
   /**
    * Returns true if a MatCap texture is defined by the user and the actor has normals
    */
   bool RenderWithMatCap(vtkActor* actor);
 
+  /**
+   * Returns the number of instances set in the mapper information, 0 if not instanced
+   */
+  int GetNumberOfInstances();
+
+  /**
+   * Upload the instance matrices if they changed and update the instancing state
+   */
+  void UpdateInstanceMatrices();
+
   vtkNew<vtkOpenGLBufferObject> JointMatrices;
+
+  vtkNew<vtkOpenGLBufferObject> InstanceMatrices;
+  vtkTimeStamp InstanceMatricesTime;
+  vtkTimeStamp InstancingToggleTime;
+  bool UseInstancing = false;
 };
 
 #endif
@@ -0,0 +1,27 @@
+#include "vtkF3DProfiledPass.h"
+
+#include "vtkF3DFrameProfiler.h"
+
+#include <vtkObjectFactory.h>
+#include <vtkRenderState.h>
+
+vtkStandardNewMacro(vtkF3DProfiledPass);
+
+//------------------------------------------------------------------------------
+void vtkF3DProfiledPass::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "ScopeName: " << this->ScopeName << "\n";
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DProfiledPass::Render(const vtkRenderState* state)
+{
+  this->NumberOfRenderedProps = 0;
+  if (this->DelegatePass)
+  {
+    vtkF3DFrameProfiler::Scope scope(state->GetRenderer(), this->ScopeName);
+    this->DelegatePass->Render(state);
+    this->NumberOfRenderedProps = this->DelegatePass->GetNumberOfRenderedProps();
+  }
+}
@@ -0,0 +1,47 @@
+/**
+ * @class   vtkF3DProfiledPass
+ * @brief   Render the delegate pass inside a named vtkF3DFrameProfiler scope
+ *
+ * This pass does nothing but timing its delegate pass, it is used to profile
+ * passes that are not implemented in F3D, like vtkSSAOPass.
+ *
+ * @sa
+ * vtkF3DFrameProfiler
+ */
+
+#ifndef vtkF3DProfiledPass_h
+#define vtkF3DProfiledPass_h
+
+#include <vtkImageProcessingPass.h>
+
+#include <string>
+
+class vtkF3DProfiledPass : public vtkImageProcessingPass
+{
+public:
+  static vtkF3DProfiledPass* New();
+  vtkTypeMacro(vtkF3DProfiledPass, vtkImageProcessingPass);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Set/Get the name of the profiler scope
+   */
+  vtkSetMacro(ScopeName, std::string);
+  vtkGetMacro(ScopeName, std::string);
+
+  /**
+   * Render the delegate pass
+   */
+  void Render(const vtkRenderState* state) override;
+
+  vtkF3DProfiledPass(const vtkF3DProfiledPass&) = delete;
+  void operator=(const vtkF3DProfiledPass&) = delete;
+
+private:
+  vtkF3DProfiledPass() = default;
+  ~vtkF3DProfiledPass() override = default;
+
+  std::string ScopeName;
+};
+
+#endif
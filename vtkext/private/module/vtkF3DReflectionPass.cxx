@@ -0,0 +1,135 @@
+#include "vtkF3DReflectionPass.h"
+
+#include <vtkObjectFactory.h>
+#include <vtkOpenGLError.h>
+#include <vtkOpenGLFramebufferObject.h>
+#include <vtkOpenGLRenderWindow.h>
+#include <vtkOpenGLState.h>
+#include <vtkRenderState.h>
+#include <vtkRenderer.h>
+#include <vtkTextureObject.h>
+
+#include <algorithm>
+#include <cmath>
+
+vtkStandardNewMacro(vtkF3DReflectionPass);
+
+//------------------------------------------------------------------------------
+vtkF3DReflectionPass::vtkF3DReflectionPass()
+  : ColorTexture(vtkSmartPointer<vtkTextureObject>::New())
+  , DepthTexture(vtkSmartPointer<vtkTextureObject>::New())
+{
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DReflectionPass::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "ResolutionScale: " << this->ResolutionScale << "\n";
+}
+
+//------------------------------------------------------------------------------
+vtkTextureObject* vtkF3DReflectionPass::GetColorTexture()
+{
+  return this->ColorTexture;
+}
+
+//------------------------------------------------------------------------------
+vtkTextureObject* vtkF3DReflectionPass::GetDepthTexture()
+{
+  return this->DepthTexture;
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DReflectionPass::Render(const vtkRenderState* state)
+{
+  vtkOpenGLClearErrorMacro();
+  this->NumberOfRenderedProps = 0;
+  this->Rendered = false;
+
+  vtkRenderer* renderer = state->GetRenderer();
+  vtkOpenGLRenderWindow* renWin = vtkOpenGLRenderWindow::SafeDownCast(renderer->GetRenderWindow());
+  vtkOpenGLState* ostate = renWin->GetState();
+
+  assert(this->DelegatePass != nullptr);
+
+  int pos[2];
+  int size[2];
+  renderer->GetTiledSizeAndOrigin(&size[0], &size[1], &pos[0], &pos[1]);
+  const int width = std::max(1, static_cast<int>(std::lround(size[0] * this->ResolutionScale)));
+  const int height = std::max(1, static_cast<int>(std::lround(size[1] * this->ResolutionScale)));
+
+  if (this->ColorTexture->GetHandle() == 0)
+  {
+    this->ColorTexture->SetContext(renWin);
+    this->ColorTexture->SetFormat(GL_RGBA);
+    this->ColorTexture->SetInternalFormat(GL_RGBA16F);
+    this->ColorTexture->SetDataType(GL_FLOAT);
+    this->ColorTexture->SetMinificationFilter(vtkTextureObject::Linear);
+    this->ColorTexture->SetMagnificationFilter(vtkTextureObject::Linear);
+    this->ColorTexture->SetWrapS(vtkTextureObject::ClampToEdge);
+    this->ColorTexture->SetWrapT(vtkTextureObject::ClampToEdge);
+    this->ColorTexture->Allocate2D(width, height, 4, VTK_FLOAT);
+
+    this->DepthTexture->SetContext(renWin);
+    this->DepthTexture->SetWrapS(vtkTextureObject::ClampToEdge);
+    this->DepthTexture->SetWrapT(vtkTextureObject::ClampToEdge);
+    this->DepthTexture->AllocateDepth(width, height, vtkTextureObject::Fixed24);
+
+    // Textures content is undefined
+    this->StateTracker.Reset();
+  }
+  this->ColorTexture->Resize(width, height);
+  this->DepthTexture->Resize(width, height);
+
+  // Reuse the textures content if nothing changed since the last render
+  if (!this->StateTracker.Update(state, width, height))
+  {
+    return;
+  }
+
+  if (this->FrameBufferObject == nullptr)
+  {
+    this->FrameBufferObject = vtkSmartPointer<vtkOpenGLFramebufferObject>::New();
+    this->FrameBufferObject->SetContext(renWin);
+  }
+
+  // The camera pass uses the size of the framebuffer of the state for the viewport
+  vtkRenderState s2(renderer);
+  s2.SetPropArrayAndCount(state->GetPropArray(), state->GetPropArrayCount());
+  s2.SetFrameBuffer(this->FrameBufferObject);
+
+  ostate->PushFramebufferBindings();
+  this->FrameBufferObject->Bind();
+  this->FrameBufferObject->AddColorAttachment(0, this->ColorTexture);
+  this->FrameBufferObject->ActivateDrawBuffers(1);
+  this->FrameBufferObject->AddDepthAttachment(this->DepthTexture);
+  this->FrameBufferObject->StartNonOrtho(width, height);
+
+  ostate->vtkglViewport(0, 0, width, height);
+  ostate->vtkglScissor(0, 0, width, height);
+  ostate->vtkglClearColor(0.0, 0.0, 0.0, 0.0);
+  ostate->vtkglClearDepth(1.0);
+  ostate->vtkglClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+  this->DelegatePass->Render(&s2);
+  this->NumberOfRenderedProps = this->DelegatePass->GetNumberOfRenderedProps();
+
+  ostate->PopFramebufferBindings();
+  this->Rendered = true;
+
+  vtkOpenGLCheckErrorMacro("failed after Render");
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DReflectionPass::ReleaseGraphicsResources(vtkWindow* window)
+{
+  this->Superclass::ReleaseGraphicsResources(window);
+
+  if (this->FrameBufferObject)
+  {
+    this->FrameBufferObject->ReleaseGraphicsResources(window);
+  }
+  this->ColorTexture->ReleaseGraphicsResources(window);
+  this->DepthTexture->ReleaseGraphicsResources(window);
+}
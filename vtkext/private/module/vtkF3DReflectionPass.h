@@ -0,0 +1,83 @@
+/**
+ * @class   vtkF3DReflectionPass
+ * @brief   Render the delegate pass in color and depth textures used for the grid reflection
+ *
+ * The delegate pass is rendered at a fraction of the renderer size, given by ResolutionScale,
+ * the grid mapper being responsible for a blurred upsampling of the result.
+ * The textures are kept as is and the delegate is not rendered again while the camera,
+ * the lights, the rendered props and the size are unchanged.
+ *
+ * @sa
+ * vtkF3DOpenGLGridMapper
+ */
+
+#ifndef vtkF3DReflectionPass_h
+#define vtkF3DReflectionPass_h
+
+#include "F3DRenderStateTracker.h"
+#include "vtkImageProcessingPass.h"
+
+#include <vtkSmartPointer.h>
+
+class vtkOpenGLFramebufferObject;
+class vtkTextureObject;
+
+class vtkF3DReflectionPass : public vtkImageProcessingPass
+{
+public:
+  static vtkF3DReflectionPass* New();
+  vtkTypeMacro(vtkF3DReflectionPass, vtkImageProcessingPass);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Perform rendering according to a render state.
+   */
+  void Render(const vtkRenderState* state) override;
+
+  /**
+   * Release graphics resources and ask components to release their own resources.
+   */
+  void ReleaseGraphicsResources(vtkWindow* window) override;
+
+  ///@{
+  /**
+   * Set/Get the fraction of the renderer size used for the reflection textures.
+   * Default is 1.0.
+   */
+  vtkSetClampMacro(ResolutionScale, double, 0.1, 1.0);
+  vtkGetMacro(ResolutionScale, double);
+  ///@}
+
+  ///@{
+  /**
+   * Get the textures the delegate pass is rendered into.
+   * They are created at construction so they can be provided before the first render.
+   */
+  vtkTextureObject* GetColorTexture();
+  vtkTextureObject* GetDepthTexture();
+  ///@}
+
+  /**
+   * Return true if the last call to Render actually rendered the delegate pass,
+   * for testing purposes.
+   */
+  vtkGetMacro(Rendered, bool);
+
+  vtkF3DReflectionPass(const vtkF3DReflectionPass&) = delete;
+  void operator=(const vtkF3DReflectionPass&) = delete;
+
+private:
+  vtkF3DReflectionPass();
+  ~vtkF3DReflectionPass() override = default;
+
+  vtkSmartPointer<vtkOpenGLFramebufferObject> FrameBufferObject;
+  vtkSmartPointer<vtkTextureObject> ColorTexture;
+  vtkSmartPointer<vtkTextureObject> DepthTexture;
+
+  double ResolutionScale = 1.0;
+  bool Rendered = false;
+
+  F3DRenderStateTracker StateTracker;
+};
+
+#endif
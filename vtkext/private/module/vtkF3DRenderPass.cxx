@@ -1,8 +1,11 @@
 #include "vtkF3DRenderPass.h"
 
+#include "vtkF3DFrameProfiler.h"
 #include "vtkF3DHexagonalBokehBlurPass.h"
 #include "vtkF3DImporter.h"
 #include "vtkF3DOpenGLGridMapper.h"
+#include "vtkF3DProfiledPass.h"
+#include "vtkF3DReflectionPass.h"
 #include "vtkF3DRenderer.h"
 #include "vtkF3DStochasticTransparentPass.h"
 #include "vtkF3DTAAPass.h"
@@ -15,6 +18,7 @@
 #include <vtkInformationIntegerKey.h>
 #include <vtkInteractorObserver.h>
 #include <vtkLightsPass.h>
+#include <vtkMath.h>
 #include <vtkMatrix4x4.h>
 #include <vtkObjectFactory.h>
 #include <vtkOpaquePass.h>
@@ -57,6 +61,23 @@ void vtkF3DRenderPass::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "UseSSAOPass: " << this->UseSSAOPass << "\n";
   os << indent << "UseBlurBackground: " << this->UseBlurBackground << "\n";
   os << indent << "ForceOpaqueBackground: " << this->ForceOpaqueBackground << "\n";
+  os << indent << "TAASamples: " << this->TAASamples << "\n";
+  os << indent << "ReflectionResolutionScale: " << this->ReflectionResolutionScale << "\n";
+}
+
+// ----------------------------------------------------------------------------
+bool vtkF3DRenderPass::IsConverged() const
+{
+  return !this->TAAPass || this->TAAPass->IsConverged();
+}
+
+// ----------------------------------------------------------------------------
+void vtkF3DRenderPass::ResetTemporalAccumulation()
+{
+  if (this->TAAPass)
+  {
+    this->TAAPass->ResetIterations();
+  }
 }
 
 // ----------------------------------------------------------------------------
@@ -155,6 +176,7 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
   }
 
   // main pass
+  this->TAAPass = nullptr;
 #if F3D_MODULE_RAYTRACING
   if (this->UseRaytracing)
   {
@@ -189,7 +211,11 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
         ssaoP->SetKernelSize(200);
         ssaoP->SetDelegatePass(ssaoCamP);
 
-        collection->AddItem(ssaoP);
+        vtkNew<vtkF3DProfiledPass> profiledSSAOP;
+        profiledSSAOP->SetScopeName("ssao");
+        profiledSSAOP->SetDelegatePass(ssaoP);
+
+        collection->AddItem(profiledSSAOP);
       }
       else
       {
@@ -240,6 +266,8 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
     {
       vtkNew<vtkF3DTAAPass> taaP;
       taaP->SetDelegatePass(camP);
+      taaP->SetNumberOfSamples(this->TAASamples);
+      this->TAAPass = taaP;
 
       s->GetRenderer()->GetRenderWindow()->AddObserver(
         vtkCommand::WindowResizeEvent, taaP.Get(), &vtkF3DTAAPass::ResetIterations);
@@ -254,8 +282,8 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
     }
 
     // reflection baking pass, same as main pass but with reflected camera
-    this->BakeReflectionPass = vtkSmartPointer<vtkFramebufferPass>::New();
-    this->BakeReflectionPass->SetColorFormat(vtkTextureObject::Float16);
+    this->BakeReflectionPass = vtkSmartPointer<vtkF3DReflectionPass>::New();
+    this->BakeReflectionPass->SetResolutionScale(this->ReflectionResolutionScale);
     this->BakeReflectionPass->SetDelegatePass(camP);
 
     for (int i = 0; i < s->GetPropArrayCount(); i++)
@@ -322,7 +350,10 @@ void vtkF3DRenderPass::Render(const vtkRenderState* s)
       this->BackgroundProps.data(), static_cast<int>(this->BackgroundProps.size()));
     backgroundState.SetFrameBuffer(s->GetFrameBuffer());
 
-    this->BackgroundPass->Render(&backgroundState);
+    {
+      vtkF3DFrameProfiler::Scope scope(r, "background");
+      this->BackgroundPass->Render(&backgroundState);
+    }
 
     // the reflection result is used in the main pass so it must be rendered before
     vtkF3DRenderer* renderer = vtkF3DRenderer::SafeDownCast(r);
@@ -331,7 +362,9 @@ void vtkF3DRenderPass::Render(const vtkRenderState* s)
     if (!this->UseRaytracing)
 #endif
     {
-      if (this->RenderReflection && renderer != nullptr)
+      // the reflection is only visible on the front side of the grid plane
+      if (this->RenderReflection && renderer != nullptr &&
+        this->IsGridFrontFaceVisible(r, renderer->GetGridMatrix()))
       {
         vtkRenderState reflState(s->GetRenderer());
         reflState.SetPropArrayAndCount(
@@ -347,7 +380,10 @@ void vtkF3DRenderPass::Render(const vtkRenderState* s)
         this->ReflectCamera(originalCam, actorMatrix, reflectedCam);
         r->SetActiveCamera(reflectedCam);
 
-        this->BakeReflectionPass->Render(&reflState);
+        {
+          vtkF3DFrameProfiler::Scope scope(r, "reflection");
+          this->BakeReflectionPass->Render(&reflState);
+        }
 
         // restore camera
         r->SetActiveCamera(originalCam);
@@ -359,20 +395,29 @@ void vtkF3DRenderPass::Render(const vtkRenderState* s)
       this->MainProps.data(), static_cast<int>(this->MainProps.size()));
     mainState.SetFrameBuffer(s->GetFrameBuffer());
 
-    this->MainPass->Render(&mainState);
+    {
+      vtkF3DFrameProfiler::Scope scope(r, "main");
+      this->MainPass->Render(&mainState);
+    }
 
     vtkRenderState mainOnTopState(s->GetRenderer());
     mainOnTopState.SetPropArrayAndCount(
       this->MainOnTopProps.data(), static_cast<int>(this->MainOnTopProps.size()));
     mainOnTopState.SetFrameBuffer(s->GetFrameBuffer());
 
-    this->MainOnTopPass->Render(&mainOnTopState);
+    {
+      vtkF3DFrameProfiler::Scope scope(r, "on top");
+      this->MainOnTopPass->Render(&mainOnTopState);
+    }
   }
 
   // restore background color before compositing the layers
   r->SetBackground(bgColor);
 
-  this->Blend(s);
+  {
+    vtkF3DFrameProfiler::Scope scope(r, "blend");
+    this->Blend(s);
+  }
 
   this->NumberOfRenderedProps = this->MainPass->GetNumberOfRenderedProps();
 }
@@ -548,3 +593,41 @@ void vtkF3DRenderPass::ReflectCamera(
   reflectedCam->SetFocalPoint(foc[0], foc[1], foc[2]);
   reflectedCam->SetViewUp(up[0], up[1], up[2]);
 }
+
+// ----------------------------------------------------------------------------
+bool vtkF3DRenderPass::IsGridFrontFaceVisible(vtkRenderer* r, vtkMatrix4x4* gridMatrix)
+{
+  // The grid plane contains its origin and is orthogonal to its Y axis, the front side
+  double n[3] = { gridMatrix->GetElement(0, 1), gridMatrix->GetElement(1, 1),
+    gridMatrix->GetElement(2, 1) };
+  vtkMath::Normalize(n);
+  const double p[3] = { gridMatrix->GetElement(0, 3), gridMatrix->GetElement(1, 3),
+    gridMatrix->GetElement(2, 3) };
+  const double d = vtkMath::Dot(n, p);
+
+  vtkCamera* cam = r->GetActiveCamera();
+  const bool backSide = cam->GetParallelProjection()
+    ? vtkMath::Dot(n, cam->GetDirectionOfProjection()) >= 0.0
+    : vtkMath::Dot(n, cam->GetPosition()) <= d;
+  if (backSide)
+  {
+    return false;
+  }
+
+  // The plane is visible only if the view frustum has corners on both sides
+  vtkNew<vtkMatrix4x4> viewToWorld;
+  vtkMatrix4x4::Invert(
+    cam->GetCompositeProjectionTransformMatrix(r->GetTiledAspectRatio(), -1, 1), viewToWorld);
+
+  bool below = false;
+  bool above = false;
+  for (int i = 0; i < 8; i++)
+  {
+    double corner[4] = { i & 1 ? 1.0 : -1.0, i & 2 ? 1.0 : -1.0, i & 4 ? 1.0 : -1.0, 1.0 };
+    viewToWorld->MultiplyPoint(corner, corner);
+    const double distance = vtkMath::Dot(n, corner) / corner[3] - d;
+    below |= distance <= 0.0;
+    above |= distance >= 0.0;
+  }
+  return below && above;
+}
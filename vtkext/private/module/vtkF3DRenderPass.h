@@ -24,9 +24,12 @@
 #include <vector>
 
 class vtkCamera;
+class vtkF3DReflectionPass;
+class vtkF3DTAAPass;
 class vtkInformationIntegerKey;
 class vtkMatrix4x4;
 class vtkProp;
+class vtkRenderer;
 
 class vtkF3DRenderPass : public vtkRenderPass
 {
@@ -45,6 +48,19 @@ public:
   vtkSetVector6Macro(Bounds, double);
   vtkSetMacro(CircleOfConfusionRadius, double);
   vtkSetMacro(RenderReflection, bool);
+  vtkSetMacro(TAASamples, int);
+  vtkSetMacro(ReflectionResolutionScale, double);
+
+  /**
+   * Return false if rendering again would improve the image without any change in the scene,
+   * which is the case when TAA has not accumulated enough samples yet.
+   */
+  bool IsConverged() const;
+
+  /**
+   * Restart the TAA accumulation, eg. when the rendered region changes without camera motion.
+   */
+  void ResetTemporalAccumulation();
 
   vtkF3DRenderPass(const vtkF3DRenderPass&) = delete;
   void operator=(const vtkF3DRenderPass&) = delete;
@@ -63,6 +79,12 @@ protected:
 
   void ReflectCamera(vtkCamera* originalCam, vtkMatrix4x4* actorMatrix, vtkCamera* reflectedCam);
 
+  /**
+   * Return true if the front side of the grid plane, where the reflection is displayed,
+   * intersects the view frustum of the active camera
+   */
+  static bool IsGridFrontFaceVisible(vtkRenderer* r, vtkMatrix4x4* gridMatrix);
+
   bool ArmatureVisible = false;
   bool UseRaytracing = false;
   bool UseSSAOPass = false;
@@ -71,11 +93,14 @@ protected:
   bool RenderReflection = false;
 
   double CircleOfConfusionRadius = 20.0;
+  int TAASamples = 64;
+  double ReflectionResolutionScale = 1.0;
 
   vtkSmartPointer<vtkFramebufferPass> BackgroundPass;
-  vtkSmartPointer<vtkFramebufferPass> BakeReflectionPass;
+  vtkSmartPointer<vtkF3DReflectionPass> BakeReflectionPass;
   vtkSmartPointer<vtkFramebufferPass> MainPass;
   vtkSmartPointer<vtkFramebufferPass> MainOnTopPass;
+  vtkSmartPointer<vtkF3DTAAPass> TAAPass;
 
   double Bounds[6] = {};
 
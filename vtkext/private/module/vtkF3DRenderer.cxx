@@ -4,10 +4,13 @@
 #include "F3DColoringInfoHandler.h"
 #include "F3DDefaultHDRI.h"
 #include "F3DLog.h"
+#include "F3DTextureCache.h"
+#include "F3DTrace.h"
 #include "F3DUtils.h"
 #include "vtkF3DCachedLUTTexture.h"
 #include "vtkF3DCachedSpecularTexture.h"
 #include "vtkF3DDisplayDepthRenderPass.h"
+#include "vtkF3DFrameProfiler.h"
 #include "vtkF3DInteractorStyle.h"
 #include "vtkF3DOpenGLGridMapper.h"
 #include "vtkF3DOverlayRenderPass.h"
@@ -33,13 +36,14 @@
 #include <vtkImageData.h>
 #include <vtkImageReader2.h>
 #include <vtkImageReader2Factory.h>
+#include <vtkInformation.h>
+#include <vtkInformationIntegerKey.h>
 #include <vtkLight.h>
 #include <vtkLightCollection.h>
 #include <vtkLightKit.h>
 #include <vtkMath.h>
 #include <vtkMathUtilities.h>
 #include <vtkMatrix4x4.h>
-#include <vtkMultiBlockDataSet.h>
 #include <vtkObjectFactory.h>
 #include <vtkOpaquePass.h>
 #include <vtkOpenGLFXAAPass.h>
@@ -72,11 +76,6 @@
 #include <vtkUniforms.h>
 #include <vtkVersion.h>
 #include <vtkVolumeProperty.h>
-#include <vtkXMLImageDataReader.h>
-#include <vtkXMLImageDataWriter.h>
-#include <vtkXMLMultiBlockDataWriter.h>
-#include <vtkXMLTableReader.h>
-#include <vtkXMLTableWriter.h>
 #include <vtk_glad.h>
 #include <vtksys/FStream.hxx>
 #include <vtksys/MD5.h>
@@ -98,9 +97,11 @@
 #include <vtkOSPRayRendererNode.h>
 #endif
 
+#include <algorithm>
 #include <cctype>
 #include <chrono>
 #include <numbers>
+#include <set>
 #include <sstream>
 
 namespace
@@ -276,11 +277,7 @@ vtkF3DRenderer::~vtkF3DRenderer() = default;
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ReleaseGraphicsResources(vtkWindow* w)
 {
-  if (this->Timer != 0)
-  {
-    glDeleteQueries(1, &this->Timer);
-    this->Timer = 0;
-  }
+  this->FrameProfiler->ReleaseGraphicsResources();
 
   this->UIActor->ReleaseGraphicsResources(w);
 
@@ -485,6 +482,8 @@ void vtkF3DRenderer::ConfigureRenderPasses()
   newPass->SetForceOpaqueBackground(this->HDRISkyboxVisible);
   newPass->SetArmatureVisible(this->ArmatureVisible);
   newPass->SetRenderReflection(this->GridVisible && this->GridReflection > 0.0);
+  newPass->SetReflectionResolutionScale(this->GridReflectionResolution);
+  newPass->SetTAASamples(this->TAASamples);
 
   double bounds[6];
   this->ComputeVisiblePropBounds(bounds);
@@ -492,10 +491,12 @@ void vtkF3DRenderer::ConfigureRenderPasses()
 
   // Image post processing passes
   vtkSmartPointer<vtkRenderPass> renderingPass = newPass;
+  this->F3DRenderPass = newPass;
 
   if (this->DisplayDepth)
   {
     // discard vtkF3DRenderPass if displaying depth
+    this->F3DRenderPass = nullptr;
     vtkNew<vtkOpaquePass> opaqueP;
     vtkNew<vtkCameraPass> camP;
     vtkNew<vtkF3DDisplayDepthRenderPass> depthP;
@@ -771,6 +772,16 @@ void vtkF3DRenderer::SetGridReflection(const double strength)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::SetGridReflectionResolution(const double scale)
+{
+  if (this->GridReflectionResolution != scale)
+  {
+    this->GridReflectionResolution = scale;
+    this->RenderPassesConfigured = false;
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::SetAxesColor(const std::vector<double>& colorXAxis,
   const std::vector<double>& colorYAxis, const std::vector<double>& colorZAxis)
@@ -1181,19 +1192,15 @@ void vtkF3DRenderer::SetCachePath(const std::string& cachePath)
 }
 
 //----------------------------------------------------------------------------
-bool vtkF3DRenderer::CheckForSHCache(std::string& path)
+bool vtkF3DRenderer::CheckForIBLCache(std::string& path)
 {
   assert(this->HasValidHDRIHash);
-  path = this->CachePath + "/" + this->HDRIHash + "/sh.vtt";
-  return vtksys::SystemTools::FileExists(path, true);
-}
+  path = this->CachePath + "/" + this->HDRIHash + "/ibl.f3dtex";
 
-//----------------------------------------------------------------------------
-bool vtkF3DRenderer::CheckForSpecCache(std::string& path)
-{
-  assert(this->HasValidHDRIHash);
-  path = this->CachePath + "/" + this->HDRIHash + "/specular.vtm";
-  return vtksys::SystemTools::FileExists(path, true);
+  // The spherical harmonics are required, as the HDRI is not read when the cache is used
+  F3DTextureCache cache;
+  return vtksys::SystemTools::FileExists(path, true) && cache.Read(path, true) &&
+    vtkSmartPointer<vtkFloatArray>::Take(cache.NewMetaData()) != nullptr;
 }
 
 //----------------------------------------------------------------------------
@@ -1318,8 +1325,7 @@ void vtkF3DRenderer::ConfigureHDRITexture()
       std::string dummy;
       needHDRITexture = this->HDRISkyboxVisible ||
         (this->GetUseImageBasedLighting() &&
-          (!this->CheckForSHCache(dummy) || !this->CheckForSpecCache(dummy) ||
-            this->UseRaytracing));
+          (!this->CheckForIBLCache(dummy) || this->UseRaytracing));
     }
 
     if (needHDRITexture)
@@ -1371,9 +1377,11 @@ void vtkF3DRenderer::ConfigureHDRILUT()
     assert(lut);
 
     // Check LUT cache
-    std::string lutCachePath = this->CachePath + "/lut.vti";
-    bool lutCacheExists = vtksys::SystemTools::FileExists(lutCachePath, true);
-    if (lutCacheExists)
+    std::string lutCachePath = this->CachePath + "/lut.f3dtex";
+    F3DTextureCache lutCache;
+    bool lutCacheValid =
+      vtksys::SystemTools::FileExists(lutCachePath, true) && lutCache.Read(lutCachePath, true);
+    if (lutCacheValid)
     {
       lut->SetFileName(lutCachePath.c_str());
       lut->UseCacheOn();
@@ -1394,10 +1402,11 @@ void vtkF3DRenderer::ConfigureHDRILUT()
           ::SaveTextureToImage(lut->GetTextureObject(), GL_TEXTURE_2D, 0, lut->GetLUTSize());
         assert(img);
 
-        vtkNew<vtkXMLImageDataWriter> writer;
-        writer->SetFileName(lutCachePath.c_str());
-        writer->SetInputData(img);
-        writer->Write();
+        if (!F3DTextureCache::Write(lutCachePath, { img }))
+        {
+          F3DLog::Print(
+            F3DLog::Severity::Warning, "Cannot write HDRI LUT cache file " + lutCachePath);
+        }
       }
       else
       {
@@ -1415,45 +1424,29 @@ void vtkF3DRenderer::ConfigureHDRISphericalHarmonics()
 {
   if (this->GetUseImageBasedLighting() && !this->HasValidHDRISH)
   {
-    // Check spherical harmonics cache
-    std::string shCachePath;
-    if (this->CheckForSHCache(shCachePath))
+    // Check spherical harmonics cache, stored alongside the specular texture
+    std::string iblCachePath;
+    F3DTextureCache cache;
+    vtkSmartPointer<vtkFloatArray> cachedSH;
+    if (this->CheckForIBLCache(iblCachePath) && cache.Read(iblCachePath, true))
     {
-      vtkNew<vtkXMLTableReader> reader;
-      reader->SetFileName(shCachePath.c_str());
-      reader->Update();
+      cachedSH = vtkSmartPointer<vtkFloatArray>::Take(cache.NewMetaData());
+    }
 
-      this->SphericalHarmonics = vtkFloatArray::SafeDownCast(reader->GetOutput()->GetColumn(0));
+    if (cachedSH)
+    {
+      this->SphericalHarmonics = cachedSH;
     }
-    else
+    else if (!this->SphericalHarmonics ||
+      this->HDRITexture->GetInput()->GetMTime() > this->SphericalHarmonics->GetMTime() ||
+      !this->HasValidHDRISH)
     {
-      if (!this->SphericalHarmonics ||
-        this->HDRITexture->GetInput()->GetMTime() > this->SphericalHarmonics->GetMTime() ||
-        !this->HasValidHDRISH)
-      {
-        vtkNew<vtkSphericalHarmonics> sh;
-        sh->SetInputData(this->HDRITexture->GetInput());
-        sh->Update();
-        this->SphericalHarmonics = vtkFloatArray::SafeDownCast(
-          vtkTable::SafeDownCast(sh->GetOutputDataObject(0))->GetColumn(0));
-      }
-
-      if (!this->CachePath.empty())
-      {
-        // Create spherical harmonics cache file
-        vtkNew<vtkTable> table;
-        table->AddColumn(this->SphericalHarmonics);
-
-        vtkNew<vtkXMLTableWriter> writer;
-        writer->SetInputData(table);
-        writer->SetFileName(shCachePath.c_str());
-        writer->Write();
-      }
-      else
-      {
-        F3DLog::Print(F3DLog::Severity::Warning,
-          "Cannot cache HDRI Spherical Harmonics as no cache path has been set.");
-      }
+      // The cache file is written in ConfigureHDRISpecular
+      vtkNew<vtkSphericalHarmonics> sh;
+      sh->SetInputData(this->HDRITexture->GetInput());
+      sh->Update();
+      this->SphericalHarmonics = vtkFloatArray::SafeDownCast(
+        vtkTable::SafeDownCast(sh->GetOutputDataObject(0))->GetColumn(0));
     }
     this->HasValidHDRISH = true;
   }
@@ -1470,10 +1463,10 @@ void vtkF3DRenderer::ConfigureHDRISpecular()
     assert(spec);
 
     // Check specular cache
-    std::string specCachePath;
-    if (this->CheckForSpecCache(specCachePath))
+    std::string iblCachePath;
+    if (this->CheckForIBLCache(iblCachePath))
     {
-      spec->SetFileName(specCachePath.c_str());
+      spec->SetFileName(iblCachePath.c_str());
       spec->UseCacheOn();
     }
     else
@@ -1491,30 +1484,29 @@ void vtkF3DRenderer::ConfigureHDRISpecular()
         unsigned int nbLevels = spec->GetPrefilterLevels();
         unsigned int size = spec->GetPrefilterSize();
 
-        vtkNew<vtkMultiBlockDataSet> mb;
-        mb->SetNumberOfBlocks(nbLevels);
-
+        std::vector<vtkSmartPointer<vtkImageData>> images;
+        std::vector<vtkImageData*> levels;
         for (unsigned int i = 0; i < nbLevels; i++)
         {
           vtkSmartPointer<vtkImageData> img = ::SaveTextureToImage(
             spec->GetTextureObject(), GL_TEXTURE_CUBE_MAP_POSITIVE_X, i, size >> i);
           assert(img);
-          mb->SetBlock(i, img);
+          images.emplace_back(img);
+          levels.emplace_back(img);
         }
 
-        vtkNew<vtkXMLMultiBlockDataWriter> writer;
-        writer->SetCompressorTypeToNone();
-        writer->SetDataModeToAppended();
-        writer->EncodeAppendedDataOff();
-        writer->SetHeaderTypeToUInt64();
-        writer->SetFileName(specCachePath.c_str());
-        writer->SetInputData(mb);
-        writer->Write();
+        // Spherical harmonics are stored in the same file as metadata
+        if (!F3DTextureCache::Write(iblCachePath, levels, this->SphericalHarmonics))
+        {
+          F3DLog::Print(
+            F3DLog::Severity::Warning, "Cannot write HDRI cache file " + iblCachePath);
+        }
       }
       else
       {
         F3DLog::Print(F3DLog::Severity::Warning,
-          "Cannot cache HDRI Specular texture as no cache path has been set.");
+          "Cannot cache HDRI Specular texture and Spherical Harmonics as no cache path has been "
+          "set.");
       }
     }
     this->HasValidHDRISpec = true;
@@ -1808,6 +1800,16 @@ void vtkF3DRenderer::SetRaytracingSamples(int samples)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::SetTAASamples(int samples)
+{
+  if (this->TAASamples != samples)
+  {
+    this->TAASamples = samples;
+    this->RenderPassesConfigured = false;
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::SetUseRaytracingDenoiser(bool use)
 {
@@ -1826,6 +1828,7 @@ void vtkF3DRenderer::ShowTimer(bool show)
   {
     this->TimerVisible = show;
     this->UIActor->SetFpsCounterVisibility(show);
+    this->FrameProfiler->SetEnabled(show);
     this->CheatSheetConfigured = false;
   }
 }
@@ -1853,6 +1856,16 @@ void vtkF3DRenderer::ShowMetaData(bool show)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::ShowMetaDataMemory(bool show)
+{
+  if (this->MetaDataMemoryVisible != show)
+  {
+    this->MetaDataMemoryVisible = show;
+    this->MetaDataConfigured = false;
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ShowHDRIFilename(bool show)
 {
@@ -1871,7 +1884,7 @@ void vtkF3DRenderer::ConfigureMetaData()
   if (this->MetaDataVisible)
   {
     assert(this->Importer);
-    this->UIActor->SetMetaData(this->Importer->GetMetaDataDescription());
+    this->UIActor->SetMetaData(this->Importer->GetMetaDataDescription(this->MetaDataMemoryVisible));
   }
   this->MetaDataConfigured = true;
 }
@@ -2077,8 +2090,10 @@ void vtkF3DRenderer::UpdateActors()
 {
   assert(this->Importer);
 
+  F3DTrace::Scope trace("update actors", "render");
+
   // Handle importer changes
-  // XXX: Importer only modify itself when adding a new importer,
+  // XXX: Importer only modify itself when adding or replacing an importer,
   // not when updating at a time step
   vtkMTimeType importerMTime = this->Importer->GetMTime();
   if (importerMTime > this->ImporterTimeStamp)
@@ -2086,6 +2101,20 @@ void vtkF3DRenderer::UpdateActors()
     this->ActorsPropertiesConfigured = false;
     this->GridConfigured = false;
     this->MetaDataConfigured = false;
+
+    // A replaced importer brings new actors and coloring information
+    this->PointSpritesConfigured = false;
+    this->NormalGlyphsConfigured = false;
+    this->ColorTransferFunctionConfigured = false;
+    this->OpacityTransferFunctionConfigured = false;
+    this->ColoringMappersConfigured = false;
+    this->ColoringPointSpritesMappersConfigured = false;
+    this->VolumePropsAndMappersConfigured = false;
+    this->ScalarBarActorConfigured = false;
+    this->ColoringConfigured = false;
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 4, 20250513)
+    this->GridAxesConfigured = false;
+#endif
   }
   this->ImporterTimeStamp = importerMTime;
 
@@ -2115,6 +2144,12 @@ void vtkF3DRenderer::UpdateActors()
   }
   this->ImporterUpdateTimeStamp = importerUpdateMTime;
 
+  // The memory used by the derived actors depends on their visibility
+  if (this->MetaDataMemoryVisible && (!this->ColoringConfigured || !this->NormalGlyphsConfigured))
+  {
+    this->MetaDataConfigured = false;
+  }
+
   if (!this->ActorsPropertiesConfigured)
   {
     this->ConfigureActorsProperties();
@@ -2188,6 +2223,8 @@ void vtkF3DRenderer::UpdateActors()
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::Render()
 {
+  F3DTrace::Scope trace("render", "render");
+
   if (this->UseNormalGlyphs)
   {
     this->UpdateNormalGlyphsScale();
@@ -2199,43 +2236,67 @@ void vtkF3DRenderer::Render()
     return;
   }
 
-  auto cpuStart = std::chrono::high_resolution_clock::now();
-  if (this->Timer == 0)
-  {
-    glGenQueries(1, &this->Timer);
-  }
-
   vtkInformation* info = this->GetInformation();
   bool uiOnly = info->Get(vtkF3DRenderPass::RENDER_UI_ONLY());
 
-#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
-  if (!uiOnly)
+  if (uiOnly)
   {
-    glBeginQuery(GL_TIME_ELAPSED, this->Timer);
+    this->Superclass::Render();
+    return;
   }
-#endif
 
-  this->Superclass::Render();
+  auto cpuStart = std::chrono::high_resolution_clock::now();
 
+  // GPU timings are read back a few frames later to never stall the CPU
+  bool newTimings = this->FrameProfiler->StartFrame();
+  {
+    vtkF3DFrameProfiler::Scope scope(this, "frame");
+    this->Superclass::Render();
+  }
+  this->FrameProfiler->EndFrame();
+
+  // Get CPU frame time
   auto cpuElapsed = std::chrono::high_resolution_clock::now() - cpuStart;
+  double elapsedTime =
+    std::chrono::duration_cast<std::chrono::microseconds>(cpuElapsed).count() * 1e-6;
+
+  const std::vector<vtkF3DFrameProfiler::Timing>& timings = this->FrameProfiler->GetTimings();
+  if (!timings.empty())
+  {
+    // Get min between CPU frame time and latest GPU frame time
+    elapsedTime = std::min(elapsedTime, timings.front().Time);
+  }
 
-  if (!uiOnly)
+  // Only report the timings read back during this render, so that they are never counted twice
+  this->FrameTimings.clear();
+  if (newTimings)
   {
-    // Get CPU frame time
-    double elapsedTime =
-      std::chrono::duration_cast<std::chrono::microseconds>(cpuElapsed).count() * 1e-6;
+    std::vector<std::pair<std::string, double>> uiTimings;
+    std::vector<std::string> path;
+    std::stringstream json;
+    json << "Frame profile: {";
+    for (const vtkF3DFrameProfiler::Timing& timing : timings)
+    {
+      path.resize(timing.Depth);
+      path.push_back(timing.Name);
 
-#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
-    glEndQuery(GL_TIME_ELAPSED);
-    GLint elapsed;
-    glGetQueryObjectiv(this->Timer, GL_QUERY_RESULT, &elapsed);
+      std::string key;
+      for (const std::string& name : path)
+      {
+        key += (key.empty() ? "" : "/") + name;
+      }
+      json << (uiTimings.empty() ? "" : ", ") << "\"" << key << "\": " << timing.Time * 1e3;
 
-    // Get min between CPU frame time and GPU frame time
-    elapsedTime = std::min(elapsedTime, elapsed * 1e-9);
-#endif
+      uiTimings.emplace_back(std::string(2 * timing.Depth, ' ') + timing.Name, timing.Time);
+      this->FrameTimings.emplace_back(key, timing.Time);
+    }
+    json << "}";
 
-    this->UIActor->UpdateFpsValue(elapsedTime);
+    this->UIActor->SetFrameTimings(uiTimings);
+    F3DLog::Print(F3DLog::Severity::Debug, json.str());
   }
+
+  this->UIActor->UpdateFpsValue(elapsedTime);
 }
 
 //----------------------------------------------------------------------------
@@ -2767,6 +2828,15 @@ void vtkF3DRenderer::ConfigurePointSprites()
       "artifacts");
   }
 
+  const auto& spritesActorsAndMappers = this->Importer->GetPointSpritesActorsAndMappers();
+  if (std::any_of(spritesActorsAndMappers.begin(), spritesActorsAndMappers.end(),
+        [](const auto& sprites) { return sprites.IsInstanced; }))
+  {
+    F3DLog::Print(F3DLog::Severity::Warning,
+      "Point sprites are not supported with instanced geometries, their surface is displayed "
+      "instead");
+  }
+
   const vtkBoundingBox& bbox = this->Importer->GetGeometryBoundingBox();
 
   double scaleFactor = 1.0;
@@ -2891,6 +2961,7 @@ void vtkF3DRenderer::ConfigurePointSprites()
 void vtkF3DRenderer::ConfigureNormalGlyphs()
 {
   bool normalGlyphsVisible = !this->UseRaytracing && this->UseNormalGlyphs;
+  bool instancedWarned = false;
   for (const auto& normalGlyph : this->Importer->GetNormalGlyphsActorsAndMappers())
   {
     if (normalGlyphsVisible && !normalGlyph.InputDataHasNormals)
@@ -2900,6 +2971,18 @@ void vtkF3DRenderer::ConfigureNormalGlyphs()
       continue;
     }
 
+    if (normalGlyph.IsInstanced)
+    {
+      if (normalGlyphsVisible && !instancedWarned)
+      {
+        F3DLog::Print(F3DLog::Severity::Warning,
+          "Normal glyphs are not supported with instanced geometries and are not displayed");
+        instancedWarned = true;
+      }
+      normalGlyph.Actor->VisibilityOff();
+      continue;
+    }
+
     this->UpdateNormalGlyphsScale();
     normalGlyph.Actor->SetVisibility(normalGlyphsVisible);
   }
@@ -3144,8 +3227,22 @@ void vtkF3DRenderer::ConfigureColoringAndVisibilities()
 {
   assert(this->Importer);
 
+  F3DTrace::Scope trace("configure coloring", "render");
+
   // Recover coloring information and update handler
   bool enableColoring = this->EnableColoring || (!this->UseRaytracing && this->UseVolume);
+  if (enableColoring)
+  {
+    // Some readers load arrays on demand, make sure the array to color with is loaded
+    if (this->ArrayNameForColoring.has_value())
+    {
+      this->Importer->LoadDeferredArrays(this->ArrayNameForColoring);
+    }
+    else
+    {
+      this->LoadDeferredArrayForColoring(std::nullopt);
+    }
+  }
   F3DColoringInfoHandler& coloringHandler = this->Importer->GetColoringInfoHandler();
   auto info = coloringHandler.SetCurrentColoring(
     enableColoring, this->UseCellColoring, this->ArrayNameForColoring, false);
@@ -3158,9 +3255,11 @@ void vtkF3DRenderer::ConfigureColoringAndVisibilities()
 
   // Handle surface geometry
   bool geometriesVisible = this->UseRaytracing || (!this->UseVolume && !this->UsePointSprites);
+  bool instancedFallbackVisible = !this->UseVolume && this->UsePointSprites;
   for (const auto& coloring : this->Importer->GetColoringActorsAndMappers())
   {
-    if (geometriesVisible &&
+    // Instanced geometries do not support point sprites, display their surface instead
+    if ((geometriesVisible || (coloring.IsInstanced && instancedFallbackVisible)) &&
       !(coloring.OriginalActor->GetPropertyKeys() &&
         coloring.OriginalActor->GetPropertyKeys()->Has(vtkF3DMetaImporter::ACTOR_HIDDEN())))
     {
@@ -3195,7 +3294,7 @@ void vtkF3DRenderer::ConfigureColoringAndVisibilities()
   bool pointSpritesVisible = !this->UseRaytracing && !this->UseVolume && this->UsePointSprites;
   for (const auto& sprites : this->Importer->GetPointSpritesActorsAndMappers())
   {
-    if (pointSpritesVisible &&
+    if (pointSpritesVisible && !sprites.IsInstanced &&
       !(sprites.OriginalActor->GetPropertyKeys() &&
         sprites.OriginalActor->GetPropertyKeys()->Has(vtkF3DMetaImporter::ACTOR_HIDDEN())))
     {
@@ -3465,6 +3564,8 @@ void vtkF3DRenderer::ConfigureRangeAndCTFForColoring(
     return;
   }
 
+  F3DTrace::Scope trace("coloring range", "render");
+
   if (this->ComponentForColoring >= info.MaximumNumberOfComponents)
   {
     F3DLog::Print(F3DLog::Severity::Warning,
@@ -3621,10 +3722,58 @@ void vtkF3DRenderer::ConfigureActorTextureTransform(vtkActor* actorBase, const d
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::LoadDeferredArrayForColoring(const std::optional<std::string>& arrayName)
+{
+  // Whether a deferred array is point or cell data is only known once loaded, so load them one
+  // at a time in name order, which is the coloring handler order, until the handler would select
+  // a loaded array before the next deferred one
+  while (true)
+  {
+    std::set<std::string> deferredNames = this->Importer->GetDeferredArrayNames();
+    auto deferredIt = arrayName.has_value() ? deferredNames.upper_bound(arrayName.value())
+                                            : deferredNames.begin();
+    if (deferredIt == deferredNames.end())
+    {
+      return;
+    }
+
+    std::optional<std::string> loadedName =
+      this->Importer->GetColoringInfoHandler().GetArrayNameAfter(
+        this->UseCellColoring, arrayName);
+    if (loadedName.has_value() && loadedName.value() < *deferredIt)
+    {
+      return;
+    }
+
+    if (!this->Importer->LoadDeferredArrays(*deferredIt))
+    {
+      return;
+    }
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::CycleArrayForColoring()
 {
   assert(this->Importer);
+
+  // Only load the deferred array that comes next, wrapping around in volume mode
+  auto currentInfo = this->Importer->GetColoringInfoHandler().GetCurrentColoringInfo();
+  std::optional<std::string> currentName;
+  if (currentInfo.has_value())
+  {
+    currentName = currentInfo.value().Name;
+  }
+  this->LoadDeferredArrayForColoring(currentName);
+  if (this->UseVolume && currentName.has_value() &&
+    !this->Importer->GetColoringInfoHandler()
+       .GetArrayNameAfter(this->UseCellColoring, currentName)
+       .has_value())
+  {
+    this->LoadDeferredArrayForColoring(std::nullopt);
+  }
+
   this->Importer->GetColoringInfoHandler().CycleColoringArray(
     !this->UseVolume); // TODO check this cond
   auto info = this->Importer->GetColoringInfoHandler().GetCurrentColoringInfo();
@@ -3725,6 +3874,50 @@ void vtkF3DRenderer::SetConsoleBadgeEnabled(bool enabled)
   this->UIActor->SetConsoleBadgeEnabled(enabled);
 }
 
+//----------------------------------------------------------------------------
+bool vtkF3DRenderer::IsUIAnimated() const
+{
+  return this->UIActor->IsAnimated();
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DRenderer::IsRenderConverged() const
+{
+  return !this->F3DRenderPass || this->F3DRenderPass->IsConverged();
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::ResetTemporalAccumulation()
+{
+  if (this->F3DRenderPass)
+  {
+    this->F3DRenderPass->ResetTemporalAccumulation();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::SetUIHidden(bool hidden)
+{
+  if (hidden)
+  {
+    this->GetInformation()->Set(vtkF3DOverlayRenderPass::HIDE_OVERLAY(), 1);
+  }
+  else
+  {
+    this->GetInformation()->Remove(vtkF3DOverlayRenderPass::HIDE_OVERLAY());
+  }
+
+  // the axis widgets are rendered by their own renderer
+  if (this->AxisWidget)
+  {
+    this->AxisWidget->GetOrientationMarker()->SetVisibility(!hidden);
+  }
+  if (this->ModernAxisRepresentation)
+  {
+    this->ModernAxisRepresentation->SetVisibility(!hidden);
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::AddNotification(
   const std::string& desc, const std::string& value, const std::string& bind, double duration)
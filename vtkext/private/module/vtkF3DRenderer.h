@@ -13,6 +13,7 @@
 
 #include "F3DStyle.h"
 
+#include "vtkF3DFrameProfiler.h"
 #include "vtkF3DMetaImporter.h"
 #include "vtkF3DUIActor.h"
 
@@ -34,6 +35,7 @@ class vtkColorTransferFunction;
 class vtkCornerAnnotation;
 class vtkDiscretizableColorTransferFunction;
 class vtkF3DOpenGLGridMapper;
+class vtkF3DRenderPass;
 class vtkGridAxesActor3D;
 class vtkImageReader2;
 class vtkPNGReader;
@@ -94,6 +96,7 @@ public:
   void ShowEdge(const std::optional<bool>& show);
   void ShowTimer(bool show);
   void ShowMetaData(bool show);
+  void ShowMetaDataMemory(bool show);
   void ShowFilename(bool show);
   void ShowHDRIFilename(bool show);
   void ShowCheatSheet(bool show);
@@ -131,6 +134,7 @@ public:
   void SetGridSubdivisions(int subdivisions);
   void SetGridColor(const std::vector<double>& color);
   void SetGridReflection(const double strength);
+  void SetGridReflectionResolution(const double scale);
   void SetAxesColor(const std::vector<double>& colorXAxis, const std::vector<double>& colorYAxis,
     const std::vector<double>& colorZAxis);
   ///@}
@@ -162,6 +166,7 @@ public:
   void SetUseBlurBackground(bool use);
   void SetBlurCircleOfConfusionRadius(double radius);
   void SetRaytracingSamples(int samples);
+  void SetTAASamples(int samples);
   void SetBackfaceType(const std::optional<std::string>& backfaceType);
   void SetFinalShader(const std::optional<std::string>& finalShader);
   ///@}
@@ -547,6 +552,47 @@ public:
    */
   void SetConsoleBadgeEnabled(bool enabled);
 
+  /**
+   * Return true if the UI must be rendered on each event loop tick, see vtkF3DUIActor::IsAnimated
+   */
+  bool IsUIAnimated() const;
+
+  /**
+   * Get the profiler measuring the GPU time of the stages of the frame,
+   * enabled when the timer is visible
+   */
+  vtkF3DFrameProfiler* GetFrameProfiler()
+  {
+    return this->FrameProfiler;
+  }
+
+  /**
+   * Get the GPU time in seconds of the stages of the profiled frame read back during the latest
+   * render, in the order the stages were started. Nested stages are named with their parents,
+   * eg: "frame/main". Empty if no profiled frame was read back during the latest render.
+   */
+  const std::vector<std::pair<std::string, double>>& GetFrameTimings() const
+  {
+    return this->FrameTimings;
+  }
+
+  /**
+   * Return false if rendering again without any change would improve the image,
+   * which is the case while TAA is accumulating samples
+   */
+  bool IsRenderConverged() const;
+
+  /**
+   * Restart the TAA accumulation, see vtkF3DRenderPass::ResetTemporalAccumulation
+   */
+  void ResetTemporalAccumulation();
+
+  /**
+   * Hide the overlay props, including the UI and the scalar bar, and the axis widget,
+   * eg. when rendering the tiles of a larger image. Default is false.
+   */
+  void SetUIHidden(bool hidden);
+
   /**
    * Add notification info to deque
    */
@@ -619,13 +665,11 @@ private:
   void ConfigureHDRISkybox();
   ///@}
 
-  ///@{
   /**
-   * Methods to check if certain HDRI caches are available
+   * Check if the HDRI cache, containing both the specular texture and the spherical harmonics,
+   * is available and valid. An invalid cache, eg: truncated, is regenerated.
    */
-  bool CheckForSpecCache(std::string& path);
-  bool CheckForSHCache(std::string& path);
-  ///@}
+  bool CheckForIBLCache(std::string& path);
 
   /**
    * Apply the given up vector to the scene, computing an appropriate right vector.
@@ -669,6 +713,12 @@ private:
    */
   void ConfigureColoringAndVisibilities();
 
+  /**
+   * Load the deferred array the coloring handler would select after the provided array name,
+   * or first if not provided, instead of loading all deferred arrays.
+   */
+  void LoadDeferredArrayForColoring(const std::optional<std::string>& arrayName);
+
   /**
    * Convenience method for configuring a poly data mapper for coloring
    * Return true if mapper was configured for coloring, false otherwise.
@@ -745,7 +795,11 @@ private:
   vtkNew<vtkSkybox> SkyboxActor;
   vtkNew<vtkF3DUIActor> UIActor;
 
-  unsigned int Timer = 0; // Timer OpenGL query
+  // Main pass of the current render passes, nullptr when displaying depth
+  vtkSmartPointer<vtkF3DRenderPass> F3DRenderPass;
+
+  vtkNew<vtkF3DFrameProfiler> FrameProfiler;
+  std::vector<std::pair<std::string, double>> FrameTimings;
 
   bool CheatSheetConfigured = false;
   bool ActorsPropertiesConfigured = false;
@@ -776,6 +830,7 @@ private:
   bool TimerVisible = false;
   bool FilenameVisible = false;
   bool MetaDataVisible = false;
+  bool MetaDataMemoryVisible = false;
   bool HDRIFilenameVisible = false;
   bool SceneHierarchyVisible = false;
   bool CheatSheetVisible = false;
@@ -797,6 +852,7 @@ private:
   bool InvertZoom = false;
 
   int RaytracingSamples = 0;
+  int TAASamples = 64;
   double UpDirection[3] = { 0.0, 1.0, 0.0 };
   double RightDirection[3] = { 1.0, 0.0, 0.0 };
   double PendingUpDirection[3] = { 0.0, 1.0, 0.0 };
@@ -807,6 +863,7 @@ private:
   int GridSubdivisions = 10;
   double GridColor[3] = { 0.0, 0.0, 0.0 };
   double GridReflection = 0.0;
+  double GridReflectionResolution = 1.0;
 
   double ColorAxisX[3] = { 0.0, 0.0, 0.0 };
   double ColorAxisY[3] = { 0.0, 0.0, 0.0 };
@@ -0,0 +1,293 @@
+#include "vtkF3DShaderCache.h"
+
+#include "F3DLog.h"
+#include "F3DTrace.h"
+
+#include <vtkObjectFactory.h>
+#include <vtkOpenGLError.h>
+#include <vtkOpenGLRenderWindow.h>
+#include <vtkOpenGLState.h>
+#include <vtkShader.h>
+#include <vtkShaderProgram.h>
+#include <vtkVersion.h>
+#include <vtk_glad.h>
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+// The protected members accessed below have been checked against VTK 9.4 and newer
+#if VTK_VERSION_NUMBER < VTK_VERSION_CHECK(9, 4, 0)
+#error "vtkF3DShaderCache accesses protected VTK members only checked with VTK 9.4 and newer"
+#endif
+
+vtkStandardNewMacro(vtkF3DShaderCache);
+
+namespace
+{
+// "F3DP" in little endian
+constexpr uint32_t CacheMagic = 0x50443346;
+
+// Increment when the layout changes so that old cache files are regenerated
+constexpr uint32_t CacheVersion = 1;
+
+struct Header
+{
+  uint32_t Magic;
+  uint32_t Version;
+  uint32_t Format;
+  uint32_t KeySize;
+  uint32_t BinarySize;
+};
+
+// vtkOpenGLState does not provide a way to set its shader cache
+struct StateAccess : public vtkOpenGLState
+{
+  static_assert(std::is_same_v<decltype(vtkOpenGLState::ShaderCache), vtkOpenGLShaderCache*>,
+    "vtkOpenGLState::ShaderCache is expected to be an owning raw pointer");
+
+  static vtkOpenGLShaderCache*& GetShaderCacheMember(vtkOpenGLState* state)
+  {
+    return state->*(&StateAccess::ShaderCache);
+  }
+};
+
+// vtkShaderProgram does not provide a way to use an already linked program
+struct ProgramAccess : public vtkShaderProgram
+{
+  static_assert(std::is_same_v<decltype(vtkShaderProgram::Handle), int> &&
+      std::is_same_v<decltype(vtkShaderProgram::Linked), bool> &&
+      std::is_same_v<decltype(vtkShaderProgram::Compiled), bool>,
+    "vtkShaderProgram Handle, Linked and Compiled members have an unexpected type");
+
+  static void SetHandle(vtkShaderProgram* program, int handle)
+  {
+    program->*(&ProgramAccess::Handle) = handle;
+  }
+
+  static void SetLinkedHandle(vtkShaderProgram* program, int handle)
+  {
+    ProgramAccess::SetHandle(program, handle);
+    program->*(&ProgramAccess::Linked) = true;
+    program->*(&ProgramAccess::Compiled) = true;
+  }
+};
+
+//----------------------------------------------------------------------------
+// Unique temporary path next to the provided one, so that concurrent writers do not interleave
+std::string GetTemporaryPath(const std::string& path)
+{
+  std::random_device device;
+  std::ostringstream tmpPath;
+  tmpPath << path << "." << std::hex << device() << device() << ".tmp";
+  return tmpPath.str();
+}
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DShaderCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "CacheDirectory: " << this->CacheDirectory << "\n";
+  os << indent << "NumberOfLoadedPrograms: " << this->NumberOfLoadedPrograms << "\n";
+  os << indent << "NumberOfSavedPrograms: " << this->NumberOfSavedPrograms << "\n";
+}
+
+//----------------------------------------------------------------------------
+vtkF3DShaderCache* vtkF3DShaderCache::Install(vtkOpenGLRenderWindow* renWin)
+{
+  vtkOpenGLState* state = renWin->GetState();
+  vtkOpenGLShaderCache*& cache = ::StateAccess::GetShaderCacheMember(state);
+
+  vtkF3DShaderCache* f3dCache = vtkF3DShaderCache::SafeDownCast(cache);
+  if (!f3dCache)
+  {
+    f3dCache = vtkF3DShaderCache::New();
+    cache->Delete();
+    cache = f3dCache;
+  }
+  return f3dCache;
+}
+
+//----------------------------------------------------------------------------
+vtkShaderProgram* vtkF3DShaderCache::ReadyShaderProgram(
+  vtkShaderProgram* shader, vtkTransformFeedback* cap)
+{
+  // Only programs that are not compiled yet are traced, not the ones that are only bound
+  std::optional<F3DTrace::Scope> trace;
+  if (shader && !shader->GetCompiled())
+  {
+    trace.emplace("compile shader", "render");
+  }
+
+  if (!shader || shader->GetCompiled() || cap || this->CacheDirectory.empty())
+  {
+    return this->Superclass::ReadyShaderProgram(shader, cap);
+  }
+
+  if (this->SupportsBinaries < 0)
+  {
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    vtkOpenGLClearErrorMacro();
+    this->SupportsBinaries = formats > 0 ? 1 : 0;
+
+    std::ostringstream driver;
+    for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+    {
+      const GLubyte* value = glGetString(name);
+      driver << (value ? reinterpret_cast<const char*>(value) : "") << "\n";
+    }
+    this->DriverDescription = driver.str();
+  }
+
+  if (this->SupportsBinaries == 0)
+  {
+    return this->Superclass::ReadyShaderProgram(shader, cap);
+  }
+
+  const std::string key = this->GetProgramKey(shader);
+  const bool loaded = this->LoadProgram(shader, key);
+  if (!loaded && shader->GetHandle() == 0)
+  {
+    // Some drivers only provide the binary of programs linked with this hint,
+    // the program is created here so that VTK attaches and links its stages into it
+    GLuint handle = glCreateProgram();
+    glProgramParameteri(handle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    ::ProgramAccess::SetHandle(shader, static_cast<int>(handle));
+  }
+
+  vtkShaderProgram* program = this->Superclass::ReadyShaderProgram(shader, cap);
+  if (program && !loaded)
+  {
+    this->SaveProgram(program, key);
+  }
+  return program;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkF3DShaderCache::GetProgramKey(vtkShaderProgram* shader)
+{
+  // Fragment outputs are bound before linking and are part of the binary
+  std::string key = this->DriverDescription;
+  key += std::to_string(shader->GetNumberOfOutputs());
+  for (vtkShader* stage : { shader->GetVertexShader(), shader->GetFragmentShader(),
+         shader->GetGeometryShader(), shader->GetComputeShader() })
+  {
+    key += "\n//F3D::Stage\n";
+    if (stage)
+    {
+      key += stage->GetSource();
+    }
+  }
+  return key;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DShaderCache::LoadProgram(vtkShaderProgram* shader, const std::string& key)
+{
+  std::ostringstream path;
+  path << this->CacheDirectory << "/" << std::hex << std::hash<std::string>{}(key) << ".f3dprog";
+
+  vtksys::ifstream file(path.str().c_str(), std::ios::binary);
+  if (!file.is_open())
+  {
+    return false;
+  }
+
+  ::Header header{};
+  file.read(reinterpret_cast<char*>(&header), sizeof(::Header));
+  if (!file || header.Magic != ::CacheMagic || header.Version != ::CacheVersion ||
+    header.KeySize != key.size() || header.BinarySize == 0)
+  {
+    return false;
+  }
+
+  // The full key is stored to discard hash collisions
+  std::string storedKey(header.KeySize, '\0');
+  file.read(storedKey.data(), static_cast<std::streamsize>(storedKey.size()));
+  std::vector<char> binary(header.BinarySize);
+  file.read(binary.data(), static_cast<std::streamsize>(binary.size()));
+  if (!file || storedKey != key)
+  {
+    return false;
+  }
+
+  GLuint handle = glCreateProgram();
+  glProgramBinary(
+    handle, static_cast<GLenum>(header.Format), binary.data(), static_cast<GLsizei>(binary.size()));
+
+  // A driver update can reject a binary, the program is then compiled from source
+  GLint status = GL_FALSE;
+  glGetProgramiv(handle, GL_LINK_STATUS, &status);
+  if (status != GL_TRUE)
+  {
+    glDeleteProgram(handle);
+    vtkOpenGLClearErrorMacro();
+    F3DLog::Print(F3DLog::Severity::Debug, "Shader program binary rejected: " + path.str());
+    return false;
+  }
+
+  ::ProgramAccess::SetLinkedHandle(shader, static_cast<int>(handle));
+  this->NumberOfLoadedPrograms++;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DShaderCache::SaveProgram(vtkShaderProgram* shader, const std::string& key)
+{
+  const GLuint handle = static_cast<GLuint>(shader->GetHandle());
+  GLint length = 0;
+  glGetProgramiv(handle, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0)
+  {
+    vtkOpenGLClearErrorMacro();
+    return;
+  }
+
+  std::vector<char> binary(length);
+  GLsizei written = 0;
+  GLenum format = 0;
+  glGetProgramBinary(handle, length, &written, &format, binary.data());
+  if (written <= 0)
+  {
+    vtkOpenGLClearErrorMacro();
+    return;
+  }
+
+  ::Header header;
+  header.Magic = ::CacheMagic;
+  header.Version = ::CacheVersion;
+  header.Format = static_cast<uint32_t>(format);
+  header.KeySize = static_cast<uint32_t>(key.size());
+  header.BinarySize = static_cast<uint32_t>(written);
+
+  std::ostringstream path;
+  path << this->CacheDirectory << "/" << std::hex << std::hash<std::string>{}(key) << ".f3dprog";
+
+  // Write to a temporary file first, multiple processes can share the same cache directory
+  const std::string tmpPath = ::GetTemporaryPath(path.str());
+  bool success;
+  {
+    vtksys::ofstream file(tmpPath.c_str(), std::ios::binary);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(::Header));
+    file.write(key.data(), static_cast<std::streamsize>(key.size()));
+    file.write(binary.data(), written);
+    success = file.good();
+  }
+
+  if (!success || !vtksys::SystemTools::RenameFile(tmpPath, path.str()))
+  {
+    vtksys::SystemTools::RemoveFile(tmpPath);
+    F3DLog::Print(
+      F3DLog::Severity::Debug, "Cannot write shader program binary cache file " + path.str());
+    return;
+  }
+  this->NumberOfSavedPrograms++;
+}
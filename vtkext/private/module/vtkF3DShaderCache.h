@@ -0,0 +1,82 @@
+/**
+ * @class   vtkF3DShaderCache
+ * @brief   Shader cache storing linked program binaries on disk
+ *
+ * This shader cache behaves like vtkOpenGLShaderCache but, when a cache directory is set,
+ * programs that need to be compiled are first looked up on disk, using a key made of the
+ * shader sources and of the OpenGL driver description. On a miss, the program is compiled
+ * from source as usual and its binary, as given by glGetProgramBinary, is written to disk.
+ * This applies to every program of the render window, including the VTK mappers, the
+ * post-processing passes and the compute shaders.
+ * Programs using transform feedback are never cached.
+ * Nothing is cached if the driver does not support any program binary format.
+ */
+
+#ifndef vtkF3DShaderCache_h
+#define vtkF3DShaderCache_h
+
+#include <vtkOpenGLShaderCache.h>
+
+#include <string>
+
+class vtkOpenGLRenderWindow;
+
+class vtkF3DShaderCache : public vtkOpenGLShaderCache
+{
+public:
+  static vtkF3DShaderCache* New();
+  vtkTypeMacro(vtkF3DShaderCache, vtkOpenGLShaderCache);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Replace the shader cache of the provided render window with a vtkF3DShaderCache.
+   * Must be called before any shader is compiled.
+   * Return the installed shader cache.
+   */
+  static vtkF3DShaderCache* Install(vtkOpenGLRenderWindow* renWin);
+
+  /**
+   * Set the directory where program binaries are stored.
+   * An empty directory, the default, disables the binary cache.
+   */
+  vtkSetMacro(CacheDirectory, std::string);
+  vtkGetMacro(CacheDirectory, std::string);
+
+  ///@{
+  /**
+   * Number of programs loaded from and saved to the binary cache, for testing purposes.
+   */
+  vtkGetMacro(NumberOfLoadedPrograms, int);
+  vtkGetMacro(NumberOfSavedPrograms, int);
+  ///@}
+
+  using vtkOpenGLShaderCache::ReadyShaderProgram;
+
+  /**
+   * Load the program from the binary cache if it is not compiled yet,
+   * then compile it if needed, save it into the binary cache and bind it.
+   */
+  vtkShaderProgram* ReadyShaderProgram(
+    vtkShaderProgram* shader, vtkTransformFeedback* cap = nullptr) override;
+
+protected:
+  vtkF3DShaderCache() = default;
+  ~vtkF3DShaderCache() override = default;
+
+private:
+  vtkF3DShaderCache(const vtkF3DShaderCache&) = delete;
+  void operator=(const vtkF3DShaderCache&) = delete;
+
+  std::string GetProgramKey(vtkShaderProgram* shader);
+  bool LoadProgram(vtkShaderProgram* shader, const std::string& key);
+  void SaveProgram(vtkShaderProgram* shader, const std::string& key);
+
+  std::string CacheDirectory;
+  std::string DriverDescription;
+  int SupportsBinaries = -1;
+
+  int NumberOfLoadedPrograms = 0;
+  int NumberOfSavedPrograms = 0;
+};
+
+#endif
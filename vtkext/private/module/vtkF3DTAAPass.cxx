@@ -1,5 +1,7 @@
 #include "vtkF3DTAAPass.h"
 
+#include "vtkF3DFrameProfiler.h"
+
 #include <vtkCamera.h>
 #include <vtkObjectFactory.h>
 #include <vtkOpenGLError.h>
@@ -15,6 +17,8 @@
 #include <vtkShaderProgram.h>
 #include <vtkTextureObject.h>
 
+#include <algorithm>
+
 vtkStandardNewMacro(vtkF3DTAAPass);
 
 //------------------------------------------------------------------------------
@@ -54,6 +58,12 @@ void vtkF3DTAAPass::Render(const vtkRenderState* state)
   }
   this->HistoryTexture->Resize(size[0], size[1]);
 
+  // Accumulated frames are outdated when something moved or changed
+  if (this->StateTracker.Update(state, size[0], size[1]))
+  {
+    this->ResetIterations();
+  }
+
   if (this->ColorTexture == nullptr)
   {
     this->ColorTexture = vtkSmartPointer<vtkTextureObject>::New();
@@ -83,6 +93,9 @@ void vtkF3DTAAPass::Render(const vtkRenderState* state)
   renWin->GetState()->PopFramebufferBindings();
   this->PostRender(state);
 
+  // Geometry rendering above is accounted in the enclosing scopes
+  vtkF3DFrameProfiler::Scope scope(state->GetRenderer(), "taa");
+
   if (!this->QuadHelper)
   {
     std::string TAAResolveFS = vtkOpenGLRenderUtilities::GetFullScreenQuadFragmentShaderTemplate();
@@ -4,12 +4,16 @@
  *
  * This pass is used to perform jittering of the geometry pass and to blend the current frame
  * with the history frame to achieve Temporal Anti-Aliasing (TAA).
+ * The history is reset when the camera, the lights or the rendered props are modified.
+ * Once NumberOfSamples frames have been accumulated, the pass is converged and the image
+ * does not improve anymore, so there is no need to render again until something changes.
  * Adapted from https://sugulee.wordpress.com/2021/06/21/temporal-anti-aliasingtaa-tutorial/
  */
 
 #ifndef vtkF3DTAAPass_h
 #define vtkF3DTAAPass_h
 
+#include "F3DRenderStateTracker.h"
 #include "vtkImageProcessingPass.h"
 
 #include <vtkSmartPointer.h>
@@ -44,6 +48,24 @@ public:
     this->HistoryIteration = 0;
   }
 
+  ///@{
+  /**
+   * Set/Get the number of accumulated frames after which the pass is converged.
+   * 0 means the pass never converges.
+   * Default is 64.
+   */
+  vtkSetClampMacro(NumberOfSamples, int, 0, 1024);
+  vtkGetMacro(NumberOfSamples, int);
+  ///@}
+
+  /**
+   * Return true if NumberOfSamples frames have been accumulated since the last reset.
+   */
+  bool IsConverged() const
+  {
+    return this->NumberOfSamples > 0 && this->HistoryIteration >= this->NumberOfSamples;
+  }
+
   /**
    * Modify shader code for jittering
    */
@@ -78,6 +100,10 @@ private:
   std::shared_ptr<vtkOpenGLQuadHelper> QuadHelper;
 
   int HistoryIteration = 0;
+  int NumberOfSamples = 64;
+
+  F3DRenderStateTracker StateTracker;
+
   float Jitter[2] = { 0.0f, 0.0f };
   int TaaHaltonNumerator[2] = { 0, 0 };
   int TaaHaltonDenominator[2] = { 1, 1 };
@@ -1,5 +1,6 @@
 #include "vtkF3DUIActor.h"
 
+#include "vtkF3DFrameProfiler.h"
 #include "vtkF3DRenderer.h"
 
 #include <vtkObjectFactory.h>
@@ -118,6 +119,7 @@ void vtkF3DUIActor::SetCheatSheet(const std::vector<CheatSheetGroup>& cheatsheet
 void vtkF3DUIActor::SetFpsCounterVisibility(bool show)
 {
   this->FpsCounterVisible = show;
+  this->FrameTimings.clear();
 }
 
 //----------------------------------------------------------------------------
@@ -159,6 +161,12 @@ void vtkF3DUIActor::UpdateAnimationTime(double currentTime)
   this->AnimationCurrentTime = currentTime;
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DUIActor::SetFrameTimings(const std::vector<std::pair<std::string, double>>& timings)
+{
+  this->FrameTimings = timings;
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DUIActor::UpdateFpsValue(const double elapsedFrameTime)
 {
@@ -231,6 +239,7 @@ void vtkF3DUIActor::SetBackdropOpacity(const double backdropOpacity)
 int vtkF3DUIActor::RenderOverlay(vtkViewport* vp)
 {
   vtkOpenGLRenderWindow* renWin = vtkOpenGLRenderWindow::SafeDownCast(vp->GetVTKWindow());
+  vtkF3DFrameProfiler::Scope scope(vtkRenderer::SafeDownCast(vp), "ui");
 
   if (!this->Initialized)
   {
@@ -321,6 +330,13 @@ int vtkF3DUIActor::RenderOverlay(vtkViewport* vp)
   return 1;
 }
 
+//----------------------------------------------------------------------------
+bool vtkF3DUIActor::IsAnimated() const
+{
+  // Notifications fade out and are removed when rendered after their stop time
+  return !this->Notifications.empty() || this->ConsoleVisible || this->MinimalConsoleVisible;
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DUIActor::AddNotification(const std::string& desc, const std::string& value,
   const std::string& bind, double startTime, double duration)
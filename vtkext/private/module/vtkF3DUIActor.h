@@ -189,6 +189,13 @@ public:
    */
   void UpdateFpsValue(const double elapsedFrameTime);
 
+  /**
+   * Set the GPU time of the stages of the frame, in seconds, displayed below the fps counter.
+   * Labels are expected to be indented according to the nesting of the stages.
+   * Empty by default
+   */
+  void SetFrameTimings(const std::vector<std::pair<std::string, double>>& timings);
+
   /**
    * Set the font file path
    * Use Inter font by default if empty
@@ -228,6 +235,12 @@ public:
   {
   }
 
+  /**
+   * Return true if the UI changes over time on its own and must be rendered
+   * on each event loop tick, eg: when notifications are displayed or the console is visible.
+   */
+  virtual bool IsAnimated() const;
+
   /**
    * Add notification info to deque
    */
@@ -397,6 +410,7 @@ protected:
 
   double TotalFrameTimes = 0.0;
   int FpsValue = 0;
+  std::vector<std::pair<std::string, double>> FrameTimings;
 
   std::string FontFile = "";
   double FontScale = 1.0;
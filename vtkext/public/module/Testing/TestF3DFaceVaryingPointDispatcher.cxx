@@ -0,0 +1,145 @@
+#include <vtkCellArray.h>
+#include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkInformation.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+
+#include "vtkF3DFaceVaryingPointDispatcher.h"
+
+#include <iostream>
+
+namespace
+{
+bool CompareCorners(vtkPolyData* ref, vtkPolyData* welded)
+{
+  if (ref->GetNumberOfPolys() != welded->GetNumberOfPolys())
+  {
+    return false;
+  }
+
+  vtkDataArray* refUV = ref->GetPointData()->GetArray("UV");
+  vtkDataArray* weldedUV = welded->GetPointData()->GetArray("UV");
+  vtkDataArray* refTemp = ref->GetPointData()->GetArray("Temperature");
+  vtkDataArray* weldedTemp = welded->GetPointData()->GetArray("Temperature");
+  vtkDataArray* refIds = ref->GetPointData()->GetArray("SourceIds");
+  vtkDataArray* weldedIds = welded->GetPointData()->GetArray("SourceIds");
+  if (!refUV || !weldedUV || !refTemp || !weldedTemp || !refIds || !weldedIds)
+  {
+    return false;
+  }
+
+  for (vtkIdType i = 0; i < ref->GetNumberOfPolys(); i++)
+  {
+    vtkIdType refSize, weldedSize;
+    const vtkIdType* refCell;
+    const vtkIdType* weldedCell;
+    ref->GetPolys()->GetCellAtId(i, refSize, refCell);
+    welded->GetPolys()->GetCellAtId(i, weldedSize, weldedCell);
+    if (refSize != weldedSize)
+    {
+      return false;
+    }
+
+    for (vtkIdType j = 0; j < refSize; j++)
+    {
+      double refPt[3], weldedPt[3];
+      ref->GetPoint(refCell[j], refPt);
+      welded->GetPoint(weldedCell[j], weldedPt);
+      if (refPt[0] != weldedPt[0] || refPt[1] != weldedPt[1] || refPt[2] != weldedPt[2] ||
+        refUV->GetComponent(refCell[j], 0) != weldedUV->GetComponent(weldedCell[j], 0) ||
+        refUV->GetComponent(refCell[j], 1) != weldedUV->GetComponent(weldedCell[j], 1) ||
+        refTemp->GetComponent(refCell[j], 0) != weldedTemp->GetComponent(weldedCell[j], 0) ||
+        refIds->GetComponent(refCell[j], 0) != weldedIds->GetComponent(weldedCell[j], 0))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestF3DFaceVaryingPointDispatcher(int argc, char* argv[])
+{
+  // Two adjacent quads with face-varying UVs, continuous except for a seam on point 1
+  vtkNew<vtkPoints> points;
+  for (int j = 0; j < 2; j++)
+  {
+    for (int i = 0; i < 3; i++)
+    {
+      points->InsertNextPoint(i, j, 0);
+    }
+  }
+
+  vtkNew<vtkCellArray> polys;
+  const vtkIdType quadA[4] = { 0, 1, 4, 3 };
+  const vtkIdType quadB[4] = { 1, 2, 5, 4 };
+  polys->InsertNextCell(4, quadA);
+  polys->InsertNextCell(4, quadB);
+
+  vtkNew<vtkFloatArray> uv;
+  uv->SetName("UV");
+  uv->SetNumberOfComponents(2);
+  for (const vtkIdType* quad : { quadA, quadB })
+  {
+    for (int j = 0; j < 4; j++)
+    {
+      double pt[3];
+      points->GetPoint(quad[j], pt);
+      uv->InsertNextTuple2(pt[0], pt[1]);
+    }
+  }
+  uv->SetTuple2(4, 5.0, 5.0);
+  uv->GetInformation()->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(), 1);
+
+  vtkNew<vtkFloatArray> temperature;
+  temperature->SetName("Temperature");
+  for (int i = 0; i < 6; i++)
+  {
+    temperature->InsertNextValue(10.f * i);
+  }
+  temperature->GetInformation()->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(), 0);
+
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  polyData->SetPolys(polys);
+  polyData->GetPointData()->AddArray(uv);
+  polyData->GetPointData()->AddArray(temperature);
+
+  vtkNew<vtkF3DFaceVaryingPointDispatcher> dispatcher;
+  dispatcher->SetInputData(polyData);
+  dispatcher->Update();
+
+  vtkNew<vtkPolyData> reference;
+  reference->DeepCopy(dispatcher->GetOutput());
+  if (reference->GetNumberOfPoints() != 8)
+  {
+    std::cerr << "Unexpected number of points without welding: "
+              << reference->GetNumberOfPoints() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  dispatcher->WeldOn();
+  dispatcher->Update();
+
+  vtkPolyData* welded = dispatcher->GetOutput();
+  if (welded->GetNumberOfPoints() != 7)
+  {
+    std::cerr << "Unexpected number of points with welding: " << welded->GetNumberOfPoints()
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (!::CompareCorners(reference, welded))
+  {
+    std::cerr << "Welded output does not match the reference output" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  dispatcher->Print(std::cout);
+
+  return EXIT_SUCCESS;
+}
@@ -6,6 +6,122 @@
 #include "vtkInformationIntegerKey.h"
 #include "vtkInformationVector.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+namespace
+{
+//------------------------------------------------------------------------------
+bool IsFaceVarying(vtkDataArray* array)
+{
+  return array->GetInformation()->Get(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE()) != 0;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Associate each cell corner to a unique output point, merging the corners that
+ * share the same source point and the same face-varying attribute values.
+ * Output points are ordered by first appearance in the cells.
+ */
+void WeldCorners(const std::vector<vtkIdType>& corners,
+  const std::vector<vtkDataArray*>& faceVaryingArrays, std::vector<vtkIdType>& pointMap,
+  std::vector<vtkIdType>& cornerOf)
+{
+  vtkIdType nbCorners = static_cast<vtkIdType>(corners.size());
+
+  auto sameKey = [&](vtkIdType a, vtkIdType b)
+  {
+    if (corners[a] != corners[b])
+    {
+      return false;
+    }
+    for (vtkDataArray* array : faceVaryingArrays)
+    {
+      for (int comp = 0; comp < array->GetNumberOfComponents(); comp++)
+      {
+        if (array->GetComponent(a, comp) != array->GetComponent(b, comp))
+        {
+          return false;
+        }
+      }
+    }
+    return true;
+  };
+
+  // hash the full attribute tuple of each corner
+  std::vector<size_t> hashes(nbCorners);
+  vtkSMPTools::For(0, nbCorners,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        size_t hash = std::hash<vtkIdType>()(corners[i]);
+        for (vtkDataArray* array : faceVaryingArrays)
+        {
+          for (int comp = 0; comp < array->GetNumberOfComponents(); comp++)
+          {
+            hash ^= std::hash<double>()(array->GetComponent(i, comp)) + 0x9e3779b9 +
+              (hash << 6) + (hash >> 2);
+          }
+        }
+        hashes[i] = hash;
+      }
+    });
+
+  // sort the corners by hash so that identical corners are contiguous,
+  // equal hashes are sorted by corner index to keep the output deterministic
+  std::vector<vtkIdType> order(nbCorners);
+  std::iota(order.begin(), order.end(), 0);
+  vtkSMPTools::Sort(order.begin(), order.end(),
+    [&](vtkIdType a, vtkIdType b)
+    { return hashes[a] != hashes[b] ? hashes[a] < hashes[b] : a < b; });
+
+  // find the first identical corner of each corner in its run of equal hashes,
+  // these runs are expected to be as small as the number of faces around a vertex
+  std::vector<vtkIdType> representative(nbCorners);
+  vtkSMPTools::For(0, nbCorners,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        vtkIdType corner = order[i];
+        vtkIdType runStart = i;
+        while (runStart > 0 && hashes[order[runStart - 1]] == hashes[corner])
+        {
+          runStart--;
+        }
+
+        representative[corner] = corner;
+        for (vtkIdType j = runStart; j < i; j++)
+        {
+          if (sameKey(order[j], corner))
+          {
+            representative[corner] = order[j];
+            break;
+          }
+        }
+      }
+    });
+
+  // representatives always have a lower index, so they are numbered first
+  cornerOf.clear();
+  for (vtkIdType i = 0; i < nbCorners; i++)
+  {
+    if (representative[i] == i)
+    {
+      pointMap[i] = static_cast<vtkIdType>(cornerOf.size());
+      cornerOf.emplace_back(i);
+    }
+    else
+    {
+      pointMap[i] = pointMap[representative[i]];
+    }
+  }
+}
+}
 
 vtkStandardNewMacro(vtkF3DFaceVaryingPointDispatcher);
 
@@ -17,6 +133,13 @@ vtkF3DFaceVaryingPointDispatcher::vtkF3DFaceVaryingPointDispatcher() = default;
 //------------------------------------------------------------------------------
 vtkF3DFaceVaryingPointDispatcher::~vtkF3DFaceVaryingPointDispatcher() = default;
 
+//------------------------------------------------------------------------------
+void vtkF3DFaceVaryingPointDispatcher::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Weld: " << this->Weld << "\n";
+}
+
 //------------------------------------------------------------------------------
 int vtkF3DFaceVaryingPointDispatcher::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** inputVector, vtkInformationVector* outputVector)
@@ -33,12 +156,7 @@ int vtkF3DFaceVaryingPointDispatcher::RequestData(vtkInformation* vtkNotUsed(req
 
   for (vtkIdType i = 0; i < nbArrays; i++)
   {
-    vtkDataArray* inputArray = inputPointData->GetArray(i);
-
-    vtkInformation* info = inputArray->GetInformation();
-    int interpType = info->Get(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE());
-
-    if (interpType != 0) // vertex
+    if (::IsFaceVarying(inputPointData->GetArray(i)))
     {
       earlyExit = false;
       break;
@@ -58,9 +176,54 @@ int vtkF3DFaceVaryingPointDispatcher::RequestData(vtkInformation* vtkNotUsed(req
   vtkIdType nbCells = inputFaces->GetNumberOfCells();
   vtkIdType nbConnectivity = inputFaces->GetNumberOfConnectivityIds();
 
-  // the number of output points is the number of total cells connectivity
+  // flatten the cells so that each cell corner can be processed independently
+  std::vector<vtkIdType> corners(nbConnectivity);
+
+  vtkNew<vtkIdTypeArray> outputOffsets;
+  outputOffsets->SetNumberOfTuples(nbCells + 1);
+
+  vtkIdType currentVertexIndex = 0;
+  for (vtkIdType i = 0; i < nbCells; i++)
+  {
+    vtkIdType cellSize;
+    const vtkIdType* cellPoints;
+    inputFaces->GetCellAtId(i, cellSize, cellPoints);
+
+    outputOffsets->SetValue(i, currentVertexIndex);
+    std::copy(cellPoints, cellPoints + cellSize, corners.begin() + currentVertexIndex);
+    currentVertexIndex += cellSize;
+  }
+  outputOffsets->SetValue(nbCells, currentVertexIndex);
+
+  std::vector<vtkDataArray*> faceVaryingArrays;
+  for (vtkIdType i = 0; i < nbArrays; i++)
+  {
+    vtkDataArray* inputArray = inputPointData->GetArray(i);
+    if (::IsFaceVarying(inputArray))
+    {
+      faceVaryingArrays.emplace_back(inputArray);
+    }
+  }
+
+  // pointMap associates each cell corner to an output point, and cornerOf associates each
+  // output point to the cell corner it is generated from
+  std::vector<vtkIdType> pointMap(nbConnectivity);
+  std::vector<vtkIdType> cornerOf;
+  if (this->Weld)
+  {
+    ::WeldCorners(corners, faceVaryingArrays, pointMap, cornerOf);
+  }
+  else
+  {
+    std::iota(pointMap.begin(), pointMap.end(), 0);
+    cornerOf = pointMap;
+  }
+
+  vtkIdType nbOutputPoints = static_cast<vtkIdType>(cornerOf.size());
+
   vtkNew<vtkPoints> outputPoints;
-  outputPoints->SetNumberOfPoints(nbConnectivity);
+  outputPoints->SetDataType(inputPoints->GetDataType());
+  outputPoints->SetNumberOfPoints(nbOutputPoints);
 
   vtkPointData* outputPointData = output->GetPointData();
 
@@ -69,73 +232,67 @@ int vtkF3DFaceVaryingPointDispatcher::RequestData(vtkInformation* vtkNotUsed(req
   outputPointData->ShallowCopy(inputPointData);
 
   // However, for vertex attributes, the arrays must be replaced by dispatching the values
-  // in order to duplicate values and correspond to the new point location
+  // in order to duplicate values and correspond to the new point location.
+  // When welding, face-varying attributes must be replaced as well
+  std::vector<std::pair<vtkDataArray*, vtkDataArray*>> vertexArrays;
+  std::vector<std::pair<vtkDataArray*, vtkDataArray*>> cornerArrays;
   for (vtkIdType i = 0; i < nbArrays; i++)
   {
     vtkDataArray* inputArray = inputPointData->GetArray(i);
+    bool faceVarying = ::IsFaceVarying(inputArray);
 
-    vtkInformation* info = inputArray->GetInformation();
-    int interpType = info->Get(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE());
-
-    if (interpType == 0) // vertex
+    if (!faceVarying || this->Weld)
     {
       auto outputArray = vtkSmartPointer<vtkDataArray>::Take(
         vtkDataArray::CreateDataArray(inputArray->GetDataType()));
       outputArray->SetNumberOfComponents(inputArray->GetNumberOfComponents());
-      outputArray->SetNumberOfTuples(nbConnectivity);
+      outputArray->SetNumberOfTuples(nbOutputPoints);
       outputArray->SetName(inputArray->GetName());
 
       outputPointData->AddArray(outputArray);
+
+      (faceVarying ? cornerArrays : vertexArrays).emplace_back(inputArray, outputArray);
     }
   }
 
-  vtkNew<vtkCellArray> outputFaces;
   vtkNew<vtkIdTypeArray> sourceIds;
   sourceIds->SetName("SourceIds");
-  sourceIds->SetNumberOfTuples(nbConnectivity);
+  sourceIds->SetNumberOfTuples(nbOutputPoints);
 
   outputPointData->AddArray(sourceIds);
 
-  std::vector<vtkIdType> cell;
-  cell.resize(inputFaces->GetMaxCellSize());
-
-  vtkIdType currentVertexIndex = 0;
-
-  for (vtkIdType i = 0; i < nbCells; i++)
-  {
-    vtkIdType cellSize;
-    const vtkIdType* cellPoints;
-    inputFaces->GetCellAtId(i, cellSize, cellPoints);
+  vtkDataArray* inputPointsData = inputPoints->GetData();
+  vtkDataArray* outputPointsData = outputPoints->GetData();
 
-    for (vtkIdType j = 0; j < cellSize; j++)
+  vtkSMPTools::For(0, nbOutputPoints,
+    [&](vtkIdType begin, vtkIdType end)
     {
-      cell[j] = currentVertexIndex + j;
-      outputPoints->SetPoint(currentVertexIndex + j, inputPoints->GetPoint(cellPoints[j]));
-      sourceIds->SetValue(currentVertexIndex + j, cellPoints[j]);
-
-      for (vtkIdType k = 0; k < nbArrays; k++)
+      for (vtkIdType i = begin; i < end; i++)
       {
-        vtkDataArray* inputArray = inputPointData->GetArray(k);
+        vtkIdType corner = cornerOf[i];
+        vtkIdType sourceId = corners[corner];
 
-        vtkInformation* info = inputArray->GetInformation();
-        int interpType = info->Get(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE());
+        outputPointsData->SetTuple(i, sourceId, inputPointsData);
+        sourceIds->SetValue(i, sourceId);
 
-        if (interpType == 0) // vertex
+        for (const auto& [inputArray, outputArray] : vertexArrays)
         {
-          vtkDataArray* outputArray = outputPointData->GetArray(inputArray->GetName());
+          outputArray->SetTuple(i, sourceId, inputArray);
+        }
 
-          if (outputArray)
-          {
-            outputArray->SetTuple(currentVertexIndex + j, inputArray->GetTuple(cellPoints[j]));
-          }
+        for (const auto& [inputArray, outputArray] : cornerArrays)
+        {
+          outputArray->SetTuple(i, corner, inputArray);
         }
       }
-    }
+    });
 
-    outputFaces->InsertNextCell(cellSize, cell.data());
+  vtkNew<vtkIdTypeArray> outputConnectivity;
+  outputConnectivity->SetNumberOfTuples(nbConnectivity);
+  std::copy(pointMap.begin(), pointMap.end(), outputConnectivity->GetPointer(0));
 
-    currentVertexIndex += cellSize;
-  }
+  vtkNew<vtkCellArray> outputFaces;
+  outputFaces->SetData(outputOffsets, outputConnectivity);
 
   output->SetPoints(outputPoints);
   output->SetPolys(outputFaces);
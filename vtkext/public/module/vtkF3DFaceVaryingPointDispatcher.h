@@ -10,6 +10,15 @@
  * For example, if we have two adjacent quads, we will have 6 points and 8 cell indices (4 per
  * quad). Face-varying attributes, even if located on point data will have 8 tuples, and not 6. It
  * can be seen as attributes, but this filter will normalize it by outputting 8 points.
+ *
+ * When Weld is enabled, cell corners sharing the same source point and the same face-varying
+ * attribute values are merged into a single output point, so that the number of output points
+ * is the number of unique vertices instead of the cell connectivity array size.
+ * In the example above, if the face-varying attributes are continuous across the shared edge,
+ * only 6 points are output.
+ *
+ * In all cases, a "SourceIds" point data array is added to the output, containing the index of
+ * the input point each output point has been generated from.
  */
 #ifndef vtkF3DFaceVaryingPointDispatcher_h
 #define vtkF3DFaceVaryingPointDispatcher_h
@@ -25,18 +34,31 @@ class VTKEXT_EXPORT vtkF3DFaceVaryingPointDispatcher : public vtkPolyDataAlgorit
 public:
   static vtkF3DFaceVaryingPointDispatcher* New();
   vtkTypeMacro(vtkF3DFaceVaryingPointDispatcher, vtkPolyDataAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
 
   /**
    * Metadata used to indicate which interpolation is used on arrays
    */
   static vtkInformationIntegerKey* INTERPOLATION_TYPE();
 
+  ///@{
+  /**
+   * Merge cell corners with identical source point and face-varying attributes.
+   * Default is false.
+   */
+  vtkSetMacro(Weld, bool);
+  vtkGetMacro(Weld, bool);
+  vtkBooleanMacro(Weld, bool);
+  ///@}
+
 protected:
   vtkF3DFaceVaryingPointDispatcher();
   ~vtkF3DFaceVaryingPointDispatcher() override;
 
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
+  bool Weld = false;
+
 private:
   vtkF3DFaceVaryingPointDispatcher(const vtkF3DFaceVaryingPointDispatcher&) = delete;
   void operator=(const vtkF3DFaceVaryingPointDispatcher&) = delete;
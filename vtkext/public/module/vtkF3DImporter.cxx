@@ -1,8 +1,13 @@
 #include "vtkF3DImporter.h"
 
+#include <vtkInformationDoubleVectorKey.h>
 #include <vtkInformationIntegerKey.h>
+#include <vtkInformationObjectBaseKey.h>
 
 vtkInformationKeyMacro(vtkF3DImporter, ACTOR_IS_ARMATURE, Integer);
+vtkInformationKeyMacro(vtkF3DImporter, MAPPER_INSTANCE_MATRICES, DoubleVector);
+vtkInformationKeyMacro(vtkF3DImporter, BLOCK_USER_MATRIX, DoubleVector);
+vtkInformationKeyMacro(vtkF3DImporter, READER_DEFERRED_ARRAYS, ObjectBase);
 
 //----------------------------------------------------------------------------
 bool vtkF3DImporter::UpdateAtTimeValue(double vtkNotUsed(timeValue))
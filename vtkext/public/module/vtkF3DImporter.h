@@ -21,7 +21,9 @@
 #endif
 /// @endcond
 
+class vtkInformationDoubleVectorKey;
 class vtkInformationIntegerKey;
+class vtkInformationObjectBaseKey;
 
 class VTKEXT_EXPORT vtkF3DImporter : public vtkImporter
 {
@@ -33,6 +35,34 @@ public:
    */
   static vtkInformationIntegerKey* ACTOR_IS_ARMATURE();
 
+  /**
+   * Information key used to instance a mapper input.
+   * It is set on the mapper information and contains 16 values per instance, the row-major
+   * matrices positioning each instance relatively to the actor.
+   * The input is uploaded once and drawn for all instances with a single draw call,
+   * which should be preferred over creating one actor per instance of a repeated geometry.
+   * Only the USD importer sets it for now. Normal glyphs and point sprites are not supported
+   * for instanced mappers and are not displayed for them.
+   */
+  static vtkInformationDoubleVectorKey* MAPPER_INSTANCE_MATRICES();
+
+  /**
+   * Information key used to position the actor of a block.
+   * It is set by readers on the metadata of a block of a composite output and contains the
+   * 16 values of a row-major matrix. The generic importer uses it as the user matrix of the actor
+   * of the block, so that a dataset repeated in multiple blocks is shared instead of being
+   * transformed for each block.
+   */
+  static vtkInformationDoubleVectorKey* BLOCK_USER_MATRIX();
+
+  /**
+   * Information key used to load arrays on demand.
+   * It is set on the reader information and contains a vtkDataArraySelection listing the arrays
+   * that are not read by default. Enabling an array in this selection must configure the reader
+   * so that the array is read on next update.
+   */
+  static vtkInformationObjectBaseKey* READER_DEFERRED_ARRAYS();
+
   /**
    * This method should be reimplemented in importer
    * implementations to handle update the importer at a specific time value